@@ -2,20 +2,128 @@
 
 ### TO USE:
 #### Press Y on the HBMenu (opens the NetLoader)
-#### Change host/port combination
+#### Change host/port combination, or pass the 3DS address as the first argument
 #### Run the script
+####
+#### With --receive, the script also listens for the log a build made with
+#### `make STREAM_HOST=<this machine's address>` streams back, and writes it to disk:
+####   send-exec.py 192.168.1.5 --receive        sends hwtests.3dsx, then receives the log
+####   send-exec.py --receive                    only receives, for an already running app
+####   send-exec.py --loopback                   checks the receiver against a local stand-in
 
+from __future__ import print_function
+
+import argparse
 import socket
 import sys
+import threading
 import time
- 
+
 TCP_IP = '192.168.xx.xx'
 TCP_PORT = 9000
-MESSAGE = open("hwtests.3dsx", "rb").read();
- 
-s = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
-s.connect((TCP_IP, TCP_PORT))
-s.send(MESSAGE)
-time.sleep(10)
-s.close()
+STREAM_PORT = 9001
+# Matches Stream::BATCH_SIZE in source/stream.cpp
+STREAM_BATCH_SIZE = 4096
+
+def send_executable(host, path):
+    message = open(path, "rb").read()
+    s = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+    s.connect((host, TCP_PORT))
+    s.sendall(message)
+    time.sleep(10)
+    s.close()
+
+def listen(port, address=''):
+    server = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+    server.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+    server.bind((address, port))
+    server.listen(1)
+    return server
+
+def receive_log(server, output_path, echo=True):
+    """Accepts one connection on `server` and writes everything it sends to `output_path`."""
+    connection, peer = server.accept()
+    if echo:
+        print("Receiving log from %s:%d into %s" % (peer[0], peer[1], output_path))
+
+    received = 0
+    with open(output_path, "wb") as output:
+        while True:
+            data = connection.recv(65536)
+            if not data:
+                break
+            output.write(data)
+            output.flush()
+            received += len(data)
+            if echo:
+                sys.stdout.write(data.decode("latin-1"))
+                sys.stdout.flush()
+
+    connection.close()
+    if echo:
+        print("\nConnection closed after %d bytes" % received)
+    return received
+
+def loopback_test(output_path):
+    """Streams a made-up log to the receiver over 127.0.0.1, batched like the app does it."""
+    lines = ["SUCCESS: [Loopback] Case %d\n" % i for i in range(2000)]
+    lines.insert(1000, "FAILURE: [Loopback] Case with a long name %s\n" % ("x" * 5000))
+    expected = "".join(lines).encode("latin-1")
+
+    server = listen(0, '127.0.0.1')
+    port = server.getsockname()[1]
+    result = {}
+    receiver = threading.Thread(target=lambda: result.update(size=receive_log(server, output_path, False)))
+    receiver.start()
+
+    client = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+    client.connect(('127.0.0.1', port))
+    pending = b""
+    for line in lines:
+        pending += line.encode("latin-1")
+        if len(pending) >= STREAM_BATCH_SIZE:
+            client.sendall(pending)
+            pending = b""
+    client.sendall(pending)
+    client.close()
+
+    receiver.join()
+    server.close()
+
+    received = open(output_path, "rb").read()
+    if received != expected:
+        print("Loopback FAILED: sent %d bytes, received %d" % (len(expected), len(received)))
+        return 1
+    print("Loopback OK: %d bytes in %s" % (len(received), output_path))
+    return 0
+
+def main():
+    parser = argparse.ArgumentParser(description="Sends hwtests to the NetLoader and receives its log.")
+    parser.add_argument("host", nargs="?", default=None, help="3DS address (default: %s)" % TCP_IP)
+    parser.add_argument("--file", default="hwtests.3dsx", help="executable to send")
+    parser.add_argument("--receive", action="store_true", help="receive the streamed log")
+    parser.add_argument("--loopback", action="store_true", help="test the receiver on this machine")
+    parser.add_argument("--port", type=int, default=STREAM_PORT, help="port to receive the log on")
+    parser.add_argument("--output", default="hwtest_log.txt", help="file to write the received log to")
+    args = parser.parse_args()
+
+    if args.loopback:
+        return loopback_test(args.output)
+
+    if not args.receive:
+        send_executable(args.host or TCP_IP, args.file)
+        return 0
+
+    # Listen before sending, so the app cannot connect before we are ready
+    server = listen(args.port)
+    if args.host:
+        send_executable(args.host, args.file)
+    try:
+        receive_log(server, args.output)
+    except KeyboardInterrupt:
+        pass
+    server.close()
+    return 0
 
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,100 @@
+#include "line_history.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace Common {
+
+LineHistory::LineHistory(size_t max_lines, size_t arena_size)
+    : arena(arena_size), arena_base(0), arena_end(0),
+      lines(max_lines), first_line(0), line_count(0), dropped(0), line_open(false)
+{
+}
+
+void LineHistory::Append(const std::string& text)
+{
+    size_t pos = 0;
+    while (pos < text.length()) {
+        size_t linebreak = text.find('\n', pos);
+        size_t end = (linebreak == std::string::npos) ? text.length() : linebreak;
+
+        if (!line_open)
+            BeginLine();
+        AppendToOpenLine(text.data() + pos, end - pos);
+
+        if (linebreak == std::string::npos)
+            break;
+
+        line_open = false;
+        pos = linebreak + 1;
+    }
+}
+
+const char* LineHistory::GetLine(size_t index, size_t* length) const
+{
+    const Line& line = LineAt(index);
+    *length = line.length;
+    return &arena[line.offset - arena_base];
+}
+
+void LineHistory::Clear()
+{
+    arena_base = arena_end = 0;
+    first_line = line_count = dropped = 0;
+    line_open = false;
+}
+
+void LineHistory::DropFirstLine()
+{
+    first_line = (first_line + 1) % lines.size();
+    line_count--;
+    dropped++;
+}
+
+void LineHistory::BeginLine()
+{
+    if (line_count == lines.size())
+        DropFirstLine();
+
+    Line& line = LineAt(line_count++);
+    line.offset = arena_base + arena_end;
+    line.length = 0;
+    line_open = true;
+}
+
+void LineHistory::AppendToOpenLine(const char* data, size_t length)
+{
+    Line& line = LineAt(line_count - 1);
+
+    // A single line may never take more than half of the arena
+    length = std::min(length, arena.size() / 2 - line.length);
+    if (length == 0)
+        return;
+
+    if (arena_end + length > arena.size())
+        MakeRoom(length);
+
+    memcpy(&arena[arena_end], data, length);
+    arena_end += length;
+    line.length += length;
+}
+
+void LineHistory::MakeRoom(size_t length)
+{
+    // Drop old lines until the retained ones fill at most half of the arena, then move them to
+    // the front in one go. Each byte is therefore moved at most once per half-arena of new text.
+    while (line_count > 1) {
+        const Line& first = LineAt(0);
+        u32 used = arena_base + arena_end - first.offset;
+        if (used + length <= arena.size() / 2)
+            break;
+        DropFirstLine();
+    }
+
+    u32 shift = LineAt(0).offset - arena_base;
+    memmove(&arena[0], &arena[shift], arena_end - shift);
+    arena_end -= shift;
+    arena_base += shift;
+}
+
+}
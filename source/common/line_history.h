@@ -0,0 +1,64 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <3ds/types.h>
+
+namespace Common {
+
+/**
+ * Bounded history of text lines. Line contents are packed back to back in one arena and indexed
+ * by offset, so appending and looking up any line are constant-time. Once the arena or the index
+ * is full, the oldest lines are dropped.
+ */
+class LineHistory {
+public:
+    LineHistory(size_t max_lines, size_t arena_size);
+
+    /**
+     * Appends `text` to the history. Every '\n' terminates the current line; trailing text
+     * without a line break stays open and is extended by the next call.
+     */
+    void Append(const std::string& text);
+
+    /// Number of retained lines, including a trailing unterminated one.
+    size_t Count() const { return line_count; }
+
+    /// Number of lines dropped from the front since the history was created or cleared.
+    size_t Dropped() const { return dropped; }
+
+    /// Returns the line at `index`, where 0 is the oldest retained line. The pointer is
+    /// invalidated by the next call to Append.
+    const char* GetLine(size_t index, size_t* length) const;
+
+    void Clear();
+
+private:
+    struct Line {
+        // Offset into the arena, counted from the start of the history (see arena_base)
+        u32 offset;
+        u32 length;
+    };
+
+    Line& LineAt(size_t index) { return lines[(first_line + index) % lines.size()]; }
+    const Line& LineAt(size_t index) const { return lines[(first_line + index) % lines.size()]; }
+
+    void DropFirstLine();
+    void BeginLine();
+    void AppendToOpenLine(const char* data, size_t length);
+    void MakeRoom(size_t length);
+
+    std::vector<char> arena;
+    // Total bytes ever shifted out of the arena; subtracted from Line::offset to get an index
+    u32 arena_base;
+    u32 arena_end;
+
+    std::vector<Line> lines;
+    size_t first_line;
+    size_t line_count;
+    size_t dropped;
+    bool line_open;
+};
+
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+// Kept free of 3DS headers so that host tools can reproduce the same sequences.
+
+#include <cstdint>
+
+namespace Common {
+
+/// Marsaglia xorshift32 generator. Cheap and reproducible from its seed, not for anything else.
+class XorShift32 {
+public:
+    explicit XorShift32(uint32_t seed) : state(seed ? seed : 1) {}
+
+    uint32_t Next()
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+
+private:
+    uint32_t state;
+};
+
+}
@@ -34,4 +34,8 @@ namespace detail {
  * }
  * \endcode
  */
-#define SCOPE_EXIT(body) auto scope_exit_helper_##__LINE__ = detail::ScopeExit([&]() body)
+#define SCOPE_EXIT(body) auto SCOPE_EXIT_CONCAT(scope_exit_helper_, __LINE__) = detail::ScopeExit([&]() body)
+
+// Two levels are needed so that __LINE__ is expanded before being pasted
+#define SCOPE_EXIT_CONCAT(a, b) SCOPE_EXIT_CONCAT_IMPL(a, b)
+#define SCOPE_EXIT_CONCAT_IMPL(a, b) a##b
@@ -0,0 +1,103 @@
+#include "common/thread.h"
+
+#include <cstdlib>
+#include <malloc.h>
+
+// newlib's allocator only serialises itself through these hooks, and the default ones do nothing.
+// Test groups allocate from threads on both cores at once, so without a lock they corrupt the
+// heap. The mutex is created by the first allocation, before any other thread exists; kernel
+// mutexes are recursive, as newlib requires.
+static Handle malloc_mutex;
+
+extern "C" void __malloc_lock(struct _reent*)
+{
+    if (!malloc_mutex)
+        svcCreateMutex(&malloc_mutex, false);
+    svcWaitSynchronization(malloc_mutex, U64_MAX);
+}
+
+extern "C" void __malloc_unlock(struct _reent*)
+{
+    svcReleaseMutex(malloc_mutex);
+}
+
+namespace Common {
+
+Thread::Thread(Func func, void* arg, s32 priority, s32 processor_id, u32 stack_size)
+    : func(func), arg(arg), handle(0)
+{
+    stack = static_cast<u32*>(memalign(8, stack_size));
+    if (!stack)
+        return;
+
+    if (svcCreateThread(&handle, Entry, (u32)(uintptr_t)this, stack + stack_size / sizeof(u32),
+                        priority, processor_id) != 0) {
+        handle = 0;
+        free(stack);
+        stack = nullptr;
+    }
+}
+
+Thread::~Thread()
+{
+    Join();
+}
+
+void Thread::Join()
+{
+    if (!handle)
+        return;
+
+    svcWaitSynchronization(handle, U64_MAX);
+    svcCloseHandle(handle);
+    handle = 0;
+    free(stack);
+    stack = nullptr;
+}
+
+void Thread::Entry(u32 arg)
+{
+    Thread* thread = reinterpret_cast<Thread*>((uintptr_t)arg);
+    thread->func(thread->arg);
+    // Threads must not return into the kernel
+    svcExitThread();
+}
+
+Result ReserveSysCoreTime()
+{
+    return APT_SetAppCpuTimeLimit(NULL, SYSCORE_TIME_PERCENT);
+}
+
+s32 GetCurrentThreadPriority()
+{
+    s32 priority = 0x30;
+    svcGetThreadPriority(&priority, CUR_THREAD_HANDLE);
+    return priority;
+}
+
+Mutex::Mutex() : handle(0)
+{
+    svcCreateMutex(&handle, false);
+}
+
+Mutex::~Mutex()
+{
+    svcCloseHandle(handle);
+}
+
+void Mutex::Lock()
+{
+    svcWaitSynchronization(handle, U64_MAX);
+}
+
+void Mutex::Unlock()
+{
+    svcReleaseMutex(handle);
+}
+
+bool Mutex::TryLock(u64 timeout_ns)
+{
+    return svcWaitSynchronization(handle, timeout_ns) == 0;
+}
+
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <3ds.h>
+
+namespace Common {
+
+/// Processor ids accepted by svcCreateThread
+enum {
+    CORE_APP = 0, ///< Application core
+    CORE_SYS = 1, ///< System core, usable once ReserveSysCoreTime grants it time
+};
+
+/// Share of the syscore's time, in percent, that ReserveSysCoreTime asks for
+static const u32 SYSCORE_TIME_PERCENT = 30;
+
+/**
+ * Asks APT for SYSCORE_TIME_PERCENT of the syscore's time. The syscore only runs application
+ * threads once it has been granted a share, so call this before creating threads on CORE_SYS.
+ */
+Result ReserveSysCoreTime();
+
+/**
+ * Kernel thread running `func(arg)` on its own heap-allocated stack. The thread starts on
+ * construction and is joined by Join() or the destructor.
+ */
+class Thread {
+public:
+    typedef void (*Func)(void* arg);
+
+    Thread(Func func, void* arg, s32 priority, s32 processor_id, u32 stack_size = 0x4000);
+    ~Thread();
+
+    Thread(const Thread&) = delete;
+    Thread& operator=(const Thread&) = delete;
+
+    /// Returns whether the kernel accepted the thread.
+    bool IsValid() const { return handle != 0; }
+
+    /// Waits for the thread to exit. Does nothing if it already has been joined.
+    void Join();
+
+private:
+    static void Entry(u32 arg);
+
+    Func func;
+    void* arg;
+    u32* stack;
+    Handle handle;
+};
+
+/// Returns the priority of the calling thread.
+s32 GetCurrentThreadPriority();
+
+/// Kernel mutex. Kernel mutexes are recursive: the owning thread may lock it again.
+class Mutex {
+public:
+    Mutex();
+    ~Mutex();
+
+    Mutex(const Mutex&) = delete;
+    Mutex& operator=(const Mutex&) = delete;
+
+    void Lock();
+    void Unlock();
+
+    /// Locks the mutex unless another thread holds it for longer than `timeout_ns`. Returns
+    /// whether it was locked.
+    bool TryLock(u64 timeout_ns);
+
+private:
+    Handle handle;
+};
+
+class LockGuard {
+public:
+    explicit LockGuard(Mutex& mutex) : mutex(mutex) { mutex.Lock(); }
+    ~LockGuard() { mutex.Unlock(); }
+
+private:
+    Mutex& mutex;
+};
+
+}
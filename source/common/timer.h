@@ -0,0 +1,18 @@
+#pragma once
+
+#include <3ds/types.h>
+
+namespace Common {
+
+/// Frequency of the counter returned by svcGetSystemTick (the ARM11 core clock).
+const u64 TICKS_PER_SECOND = 268111856ULL;
+
+/// Duration of one frame at the LCD refresh rate of ~59.83Hz, in system ticks.
+const u64 TICKS_PER_FRAME = 4481134ULL;
+
+inline u64 TicksToMicroseconds(u64 ticks)
+{
+    return ticks * 1000000ULL / TICKS_PER_SECOND;
+}
+
+}
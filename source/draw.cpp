@@ -8,17 +8,152 @@
 
 #include "font.h"
 
+static GSP_FramebufferFormats screen_formats[2] = { GSP_BGR8_OES, GSP_BGR8_OES };
+
 Rect GetScreenSize(gfxScreen_t screen)
 {
     return { (screen == GFX_TOP) ? 400 : 320, 240 };
 }
 
+void SetScreenFormat(gfxScreen_t screen, GSP_FramebufferFormats format)
+{
+    if (format != GSP_BGR8_OES && format != GSP_RGB565_OES)
+        return;
+
+    gfxSetScreenFormat(screen, format);
+    screen_formats[screen] = format;
+}
+
+GSP_FramebufferFormats GetScreenFormat(gfxScreen_t screen)
+{
+    return screen_formats[screen];
+}
+
+// Pixel kernels for each supported framebuffer format. Each one holds a color prepared for its
+// format and knows how to store or blend it into a single pixel.
+
+struct PixelBGR8 {
+    static const int BYTES = 3;
+
+    u8 r, g, b;
+
+    PixelBGR8(u8 r, u8 g, u8 b) : r(r), g(g), b(b) {}
+
+    void Store(u8* px) const
+    {
+        px[0] = b;
+        px[1] = g;
+        px[2] = r;
+    }
+
+    void Blend(u8* px, u8 v) const
+    {
+        px[0] = (px[0] * (0xFF - v) + (b * v)) >> 8;
+        px[1] = (px[1] * (0xFF - v) + (g * v)) >> 8;
+        px[2] = (px[2] * (0xFF - v) + (r * v)) >> 8;
+    }
+};
+
+struct PixelRGB565 {
+    static const int BYTES = 2;
+
+    // Green is moved into the upper halfword so that all three channels can be blended with a
+    // single multiply, with enough headroom between them to never carry into each other.
+    static const u32 SPREAD_MASK = 0x07E0F81F;
+
+    u16 packed;
+    u32 spread;
+
+    PixelRGB565(u8 r, u8 g, u8 b)
+        : packed(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)),
+          spread((packed | (packed << 16)) & SPREAD_MASK) {}
+
+    void Store(u8* px) const
+    {
+        *reinterpret_cast<u16*>(px) = packed;
+    }
+
+    void Blend(u8* px, u8 v) const
+    {
+        u16* dst = reinterpret_cast<u16*>(px);
+        u32 alpha = (v + 4) >> 3;
+        u32 bg = (*dst | (*dst << 16)) & SPREAD_MASK;
+        u32 result = ((((spread - bg) * alpha) >> 5) + bg) & SPREAD_MASK;
+        *dst = (u16)(result | (result >> 16));
+    }
+};
+
 // This code is not meant to be readable -- Smea
-int DrawCharacter(u8* fb, font_s* font, char c, s16 x, s16 y, u16 w, u16 h)
+template <typename Pixel>
+static void DrawGlyphRaw(u8* fb, const u8* charData, const Glyph* cd, s16 cyo, s16 ch, u16 h,
+                         const Pixel& color)
 {
-    Glyph* cd = &font->desc[(int)c];
+    for (int i = 0; i < cd->w; i++) {
+        charData += cyo;
+        for (int j = 0; j < ch; j++) {
+            u8 v = *(charData++);
+            if (v)
+                color.Blend(fb, v);
+            fb += Pixel::BYTES;
+        }
+        charData += (cd->h - (cyo + ch));
+        fb += (h - ch) * Pixel::BYTES;
+    }
+}
+
+// Consumes the runs directly: transparent runs are skipped as a whole and opaque runs become
+// plain stores, so only antialiased edge pixels are blended.
+template <typename Pixel>
+static void DrawGlyphRLE(u8* fb, const u8* runs, const Glyph* cd, s16 cyo, s16 ch, u16 h,
+                         const Pixel& color)
+{
+    const int clip_end = cyo + ch;
+
+    for (int i = 0; i < cd->w; i++) {
+        // `fb` points at glyph row `cyo` of the current column
+        int j = 0;
+        while (j < cd->h) {
+            u8 run = *(runs++);
+            int type = run >> 6;
+            int length = (run & 0x3F) + 1;
+            const u8* values = runs;
+            if (type == RUN_LITERAL)
+                runs += length;
+
+            int begin = (j > cyo) ? j : cyo;
+            int end = (j + length < clip_end) ? j + length : clip_end;
 
-    if (!cd->data)
+            if (type == RUN_OPAQUE) {
+                for (int k = begin; k < end; k++)
+                    color.Store(fb + (k - cyo) * Pixel::BYTES);
+            } else if (type == RUN_LITERAL) {
+                for (int k = begin; k < end; k++)
+                    color.Blend(fb + (k - cyo) * Pixel::BYTES, values[k - j]);
+            }
+            j += length;
+        }
+        fb += h * Pixel::BYTES;
+    }
+}
+
+template <typename Pixel>
+static void DrawGlyph(u8* fb, const font_s* font, const Glyph* cd, s16 x, s16 cy, s16 cyo, s16 ch, u16 h)
+{
+    const u8* charData = font->coverage + cd->offset;
+    const Pixel color(font->color[0], font->color[1], font->color[2]);
+
+    fb += (x * h + cy) * Pixel::BYTES;
+    if (cd->flags & GLYPH_RLE)
+        DrawGlyphRLE(fb, charData, cd, cyo, ch, h, color);
+    else
+        DrawGlyphRaw(fb, charData, cd, cyo, ch, h, color);
+}
+
+int DrawCharacter(u8* fb, font_s* font, char c, s16 x, s16 y, u16 w, u16 h, GSP_FramebufferFormats format)
+{
+    const Glyph* cd = GetGlyph(font, c);
+
+    if (!cd)
         return 0;
 
     x += cd->xo; y += font->height - cd->yo - cd->h;
@@ -26,7 +161,6 @@ int DrawCharacter(u8* fb, font_s* font, char c, s16 x, s16 y, u16 w, u16 h)
     if (x < 0 || x + cd->w >= w || y < -cd->h || y >= h + cd->h)
         return 0;
 
-    u8* charData = cd->data;
     s16 cy = y, ch = cd->h, cyo = 0;
 
     if (y < 0) {
@@ -37,41 +171,42 @@ int DrawCharacter(u8* fb, font_s* font, char c, s16 x, s16 y, u16 w, u16 h)
         ch = h - y;
     }
 
-    fb += (x * h + cy) * 3;
-    const u8 r = font->color[0];
-    const u8 g = font->color[1];
-    const u8 b = font->color[2];
-
-    for (int i = 0; i < cd->w; i++) {
-        charData += cyo;
-        for (int j = 0; j < ch; j++) {
-            u8 v = *(charData++);
-            if (v) {
-                fb[0] = (fb[0] * (0xFF - v) + (b * v)) >> 8;
-                fb[1] = (fb[1] * (0xFF - v) + (g * v)) >> 8;
-                fb[2] = (fb[2] * (0xFF - v) + (r * v)) >> 8;
-            }
-            fb += 3;
-        }
-        charData += (cd->h - (cyo + ch));
-        fb += (h - ch) * 3;
-    }
+    if (format == GSP_RGB565_OES)
+        DrawGlyph<PixelRGB565>(fb, font, cd, x, cy, cyo, ch, h);
+    else
+        DrawGlyph<PixelBGR8>(fb, font, cd, x, cy, cyo, ch, h);
     return cd->xa;
 }
 
-void DrawString(u8* fb, font_s* f, const std::string& str, s16 x, s16 y, u16 w, u16 h)
+void DrawString(u8* fb, font_s* f, const std::string& str, s16 x, s16 y, u16 w, u16 h, GSP_FramebufferFormats format)
 {
     if (!f || !fb)
         return;
 
-    int dx = 0, dy = 0;
-    for (const char& c : str)
-    {
-        dx += DrawCharacter(fb, f, c, x + dx, y + dy, w, h);
-        if (c == '\n') {
-            dx = 0;
-            dy -= f->height;
-        }
+    // Glyphs never extend outside of their line's font height, so lines can be clipped as a
+    // whole. Lines run downwards (towards lower framebuffer y) starting at `y`.
+    size_t pos = 0;
+    int line_y = y;
+    while (line_y >= h) {
+        pos = str.find('\n', pos);
+        if (pos == std::string::npos)
+            return;
+        pos++;
+        line_y -= f->height;
+    }
+
+    while (pos < str.length() && line_y + f->height > 0) {
+        size_t line_end = str.find('\n', pos);
+        if (line_end == std::string::npos)
+            line_end = str.length();
+
+        // Stop at the right edge; DrawCharacter rejects anything past it anyway
+        int dx = 0;
+        for (size_t i = pos; i < line_end && x + dx < w; i++)
+            dx += DrawCharacter(fb, f, str[i], x + dx, line_y, w, h, format);
+
+        pos = line_end + 1;
+        line_y -= f->height;
     }
 }
 
@@ -83,16 +218,56 @@ void DrawText(gfxScreen_t screen, gfx3dSide_t side, font_s* font, const std::str
     u16 fbWidth, fbHeight;
     u8* fbAdr = gfxGetFramebuffer(screen, side, &fbWidth, &fbHeight);
 
-    DrawString(fbAdr, font, str, y, x, fbHeight, fbWidth);
+    DrawString(fbAdr, font, str, y, x, fbHeight, fbWidth, GetScreenFormat(screen));
 }
 
 void FillScreen(gfxScreen_t screen, u8 bg_r, u8 bg_g, u8 bg_b)
 {
     Rect screen_size = GetScreenSize(screen);
     u8* fb_addr = gfxGetFramebuffer(screen, GFX_LEFT, nullptr, nullptr);
+
+    if (GetScreenFormat(screen) == GSP_RGB565_OES) {
+        // Two pixels per store; both screens have an even number of pixels
+        u32 pixels = PixelRGB565(bg_r, bg_g, bg_b).packed;
+        pixels |= pixels << 16;
+        u32* fb_words = reinterpret_cast<u32*>(fb_addr);
+        for (int i = 0; i < screen_size.w * screen_size.h / 2; i++)
+            fb_words[i] = pixels;
+        return;
+    }
+
     for (int i = 0; i < screen_size.w * screen_size.h * 3; i += 3) {
         fb_addr[i]   = bg_b;
         fb_addr[i+1] = bg_g;
         fb_addr[i+2] = bg_r;
     }
 }
+
+template <typename Pixel>
+static void FillColumns(u8* fb_addr, int column_height, int x, int y, int w, int h, const Pixel& color)
+{
+    for (int i = x; i < x + w; i++) {
+        u8* column = fb_addr + (i * column_height + y) * Pixel::BYTES;
+        for (int j = 0; j < h; j++)
+            color.Store(column + j * Pixel::BYTES);
+    }
+}
+
+void FillRect(gfxScreen_t screen, int x, int y, int w, int h, u8 r, u8 g, u8 b)
+{
+    Rect screen_size = GetScreenSize(screen);
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > screen_size.w) w = screen_size.w - x;
+    if (y + h > screen_size.h) h = screen_size.h - y;
+    if (w <= 0 || h <= 0)
+        return;
+
+    // Framebuffers are rotated: each screen column is stored bottom to top
+    u8* fb_addr = gfxGetFramebuffer(screen, GFX_LEFT, nullptr, nullptr);
+    int fb_y = screen_size.h - (y + h);
+    if (GetScreenFormat(screen) == GSP_RGB565_OES)
+        FillColumns(fb_addr, screen_size.h, x, fb_y, w, h, PixelRGB565(r, g, b));
+    else
+        FillColumns(fb_addr, screen_size.h, x, fb_y, w, h, PixelBGR8(r, g, b));
+}
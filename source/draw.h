@@ -12,7 +12,19 @@ struct Rect {
 
 Rect GetScreenSize(gfxScreen_t screen);
 
-int DrawCharacter(u8* fb, font_s* f, char c, s16 x, s16 y, u16 w, u16 h);
-void DrawString(u8* fb, font_s* f, const std::string& str, s16 x, s16 y, u16 w, u16 h);
+/**
+ * Switches the framebuffer format of `screen`. Only GSP_BGR8_OES (the default, for exact colors)
+ * and GSP_RGB565_OES (half the bandwidth per pixel) are supported; other formats are ignored.
+ */
+void SetScreenFormat(gfxScreen_t screen, GSP_FramebufferFormats format);
+GSP_FramebufferFormats GetScreenFormat(gfxScreen_t screen);
+
+int DrawCharacter(u8* fb, font_s* f, char c, s16 x, s16 y, u16 w, u16 h,
+                  GSP_FramebufferFormats format = GSP_BGR8_OES);
+void DrawString(u8* fb, font_s* f, const std::string& str, s16 x, s16 y, u16 w, u16 h,
+                GSP_FramebufferFormats format = GSP_BGR8_OES);
 void DrawText(gfxScreen_t screen, gfx3dSide_t side, font_s* f, const std::string& str, s16 x, s16 y);
 void FillScreen(gfxScreen_t screen, u8 bg_r, u8 bg_g, u8 bg_b);
+
+/// Fills the rectangle whose top-left corner is at screen coordinates (`x`, `y`).
+void FillRect(gfxScreen_t screen, int x, int y, int w, int h, u8 r, u8 g, u8 b);
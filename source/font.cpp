@@ -1,9 +1,114 @@
 #include <3ds.h>
 #include "font.h"
 
-font_s fontDefault = {
-    font1Data,
-    font1Desc,
-    16,
-    { 0xFF, 0xFF, 0xFF }
-};
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// data/font.bin, embedded by the build
+extern const u8 font_bin[];
+extern const u32 font_bin_size;
+
+static const u8 FONT_VERSION = 1;
+
+static font_s MakeDefaultFont()
+{
+    font_s font = {};
+    font.color[0] = font.color[1] = font.color[2] = 0xFF;
+    LoadFont(&font, font_bin, font_bin_size);
+    return font;
+}
+
+font_s fontDefault = MakeDefaultFont();
+
+// Returns whether the coverage of `glyph` lies within the `available` bytes at `coverage`, and
+// whether its runs, if it has any, are well formed.
+static bool IsGlyphValid(const Glyph& glyph, const u8* coverage, u32 available)
+{
+    if (glyph.offset > available)
+        return false;
+    available -= glyph.offset;
+
+    if (!(glyph.flags & GLYPH_RLE))
+        return (u32)glyph.w * glyph.h <= available;
+
+    const u8* runs = coverage + glyph.offset;
+    u32 pos = 0;
+    for (int i = 0; i < glyph.w; i++) {
+        int j = 0;
+        while (j < glyph.h) {
+            if (pos >= available)
+                return false;
+            u8 run = runs[pos++];
+            int type = run >> 6;
+            int length = (run & 0x3F) + 1;
+            if (type > RUN_LITERAL || j + length > glyph.h)
+                return false;
+            if (type == RUN_LITERAL) {
+                if ((u32)length > available - pos)
+                    return false;
+                pos += length;
+            }
+            j += length;
+        }
+    }
+    return true;
+}
+
+bool LoadFont(font_s* font, const u8* data, u32 size)
+{
+    const FontHeader* header = reinterpret_cast<const FontHeader*>(data);
+    if (size < sizeof(FontHeader) + 256 || memcmp(header->magic, "HWFN", 4) != 0 ||
+        header->version != FONT_VERSION)
+        return false;
+
+    // Fonts can come from the SD card, so everything the renderer reads is checked to be in bounds
+    if (header->glyph_offset < sizeof(FontHeader) + 256 || header->glyph_offset % alignof(Glyph) != 0 ||
+        header->glyph_offset > size || header->glyph_count > (size - header->glyph_offset) / sizeof(Glyph) ||
+        header->coverage_offset > size)
+        return false;
+
+    const u8* codepoints = data + sizeof(FontHeader);
+    for (int c = 0; c < 256; c++) {
+        if (codepoints[c] > header->glyph_count)
+            return false;
+    }
+
+    const Glyph* glyphs = reinterpret_cast<const Glyph*>(data + header->glyph_offset);
+    const u8* coverage = data + header->coverage_offset;
+    for (u32 i = 0; i < header->glyph_count; i++) {
+        if (!IsGlyphValid(glyphs[i], coverage, size - header->coverage_offset))
+            return false;
+    }
+
+    font->codepoints = codepoints;
+    font->glyphs = glyphs;
+    font->coverage = coverage;
+    font->height = header->height;
+    return true;
+}
+
+bool LoadFontFile(font_s* font, const char* path)
+{
+    FILE* file = fopen(path, "rb");
+    if (!file)
+        return false;
+
+    long size = -1;
+    if (fseek(file, 0, SEEK_END) == 0)
+        size = ftell(file);
+    if (size <= 0 || fseek(file, 0, SEEK_SET) != 0) {
+        fclose(file);
+        return false;
+    }
+
+    // Fonts stay in use until exit, so the buffer is never freed
+    u8* data = static_cast<u8*>(malloc(size));
+    bool loaded = data && fread(data, 1, size, file) == (size_t)size &&
+                  LoadFont(font, data, size);
+    fclose(file);
+
+    if (!loaded)
+        free(data);
+    return loaded;
+}
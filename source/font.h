@@ -1,34 +1,81 @@
 #pragma once
 
-struct Glyph {
-    // Glyph representation
-    char c;
+#include <3ds.h>
+
+/**
+ * Fonts are stored as a single packed blob (see tools/mkfont.py) which is used in place:
+ *
+ *   FontHeader
+ *   u8 codepoints[256]   Index + 1 of the glyph for each codepoint, 0 if it has none
+ *   Glyph glyphs[]
+ *   u8 coverage[]        Column-major coverage of every glyph
+ *
+ * Glyph coverage is stored with 8 bits per pixel, or run-length encoded if GLYPH_RLE is set in
+ * the glyph's flags. RLE columns are sequences of runs that never cross into the next column;
+ * each run starts with a byte holding a GlyphRun type in its top two bits and the run length
+ * minus one in the rest, and literal runs are followed by one coverage byte per pixel.
+ */
+struct FontHeader {
+    char magic[4];
+    u8 version;
+    u8 height;
+    u16 glyph_count;
+    u32 glyph_offset;
+    u32 coverage_offset;
+};
 
-    // x and y origin of the character.
-    int x, y;
+struct Glyph {
+    // Offset of the glyph's coverage data in the coverage block.
+    u16 offset;
 
     // width and height in pixels.
-    int w, h;
+    u8 w, h;
 
     // x and y offset
-    int xo, yo;
+    s8 xo, yo;
 
     // Pixels after this character to begin
     // drawing the next one.
-    int xa;
+    u8 xa;
+
+    u8 flags;
+};
+
+enum GlyphFlags {
+    GLYPH_RLE = 0x01,
+};
 
-    // Glyph data.
-    u8* data;
+enum GlyphRun {
+    RUN_TRANSPARENT = 0,
+    RUN_OPAQUE      = 1,
+    RUN_LITERAL     = 2,
 };
 
+static_assert(sizeof(FontHeader) == 16, "FontHeader must match the packed font format");
+static_assert(sizeof(Glyph) == 8, "Glyph must match the packed font format");
+
 struct font_s {
-    u8* data;
-    Glyph* desc;
+    const u8* codepoints;
+    const Glyph* glyphs;
+    const u8* coverage;
     u8 height;
     u8 color[3];
 };
 
-extern u8 font1Data[];
-extern Glyph font1Desc[];
+/// Returns the glyph for `c`, or nullptr if the font has none.
+inline const Glyph* GetGlyph(const font_s* font, char c)
+{
+    u8 index = font->codepoints[(u8)c];
+    return index ? &font->glyphs[index - 1] : nullptr;
+}
+
+/**
+ * Points `font` at the packed font in `data`, keeping its color. The data is used in place and
+ * must outlive the font. Returns false, leaving `font` untouched, if `data` is not a valid font.
+ */
+bool LoadFont(font_s* font, const u8* data, u32 size);
+
+/// Replaces the glyphs of `font` with the packed font stored in the file at `path`.
+bool LoadFontFile(font_s* font, const char* path);
 
 extern font_s fontDefault;
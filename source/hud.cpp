@@ -0,0 +1,138 @@
+#include "hud.h"
+
+#include <3ds.h>
+
+#include "draw.h"
+#include "common/string_funcs.h"
+#include "common/timer.h"
+
+namespace HUD {
+
+static const int WINDOW_SIZE = 60;
+
+struct FrameRecord {
+    u32 ticks[NUM_STAGES];
+    u32 total;
+};
+
+static bool enabled = false;
+
+static FrameRecord window[WINDOW_SIZE];
+static int window_pos = 0;
+static int window_count = 0;
+
+static u64 last_vblank = 0;
+static u32 presents_since_vblank = 0;
+static u32 missed_vblanks = 0;
+
+bool IsEnabled()
+{
+    return enabled;
+}
+
+void SetEnabled(bool enable)
+{
+    if (enable && !enabled) {
+        window_pos = 0;
+        window_count = 0;
+        last_vblank = 0;
+        missed_vblanks = 0;
+    }
+    enabled = enable;
+}
+
+static void RecordFrame(const u64 (&ticks)[NUM_STAGES])
+{
+    FrameRecord& record = window[window_pos];
+    record.total = 0;
+    for (int i = 0; i < NUM_STAGES; i++) {
+        record.ticks[i] = ticks[i];
+        record.total += ticks[i];
+    }
+    window_pos = (window_pos + 1) % WINDOW_SIZE;
+    if (window_count < WINDOW_SIZE)
+        window_count++;
+}
+
+void WaitForVBlank()
+{
+    gspWaitForEvent(GSPEVENT_VBlank0, false);
+    u64 now = svcGetSystemTick();
+
+    // With exactly one present since the previous wait, every VBlank in between but the one
+    // the frame went out on was missed
+    if (enabled && last_vblank != 0 && presents_since_vblank == 1) {
+        u64 interval = now - last_vblank;
+        if (interval > Common::TICKS_PER_FRAME * 3 / 2)
+            missed_vblanks += (interval + Common::TICKS_PER_FRAME / 2) / Common::TICKS_PER_FRAME - 1;
+    }
+    last_vblank = now;
+    presents_since_vblank = 0;
+}
+
+FrameTimer::FrameTimer() : enabled(IsEnabled()), last(0), ticks()
+{
+    presents_since_vblank++;
+    if (enabled)
+        last = svcGetSystemTick();
+}
+
+FrameTimer::~FrameTimer()
+{
+    if (enabled)
+        RecordFrame(ticks);
+}
+
+void FrameTimer::Lap(Stage stage)
+{
+    if (!enabled)
+        return;
+
+    u64 now = svcGetSystemTick();
+    ticks[stage] += now - last;
+    last = now;
+}
+
+static float ToMilliseconds(u64 ticks)
+{
+    return Common::TicksToMicroseconds(ticks) / 1000.0f;
+}
+
+void Draw()
+{
+    if (!enabled || window_count == 0)
+        return;
+
+    u64 stage_sum[NUM_STAGES] = {};
+    u64 total_sum = 0;
+    u32 total_min = window[0].total;
+    u32 total_max = window[0].total;
+    for (int i = 0; i < window_count; i++) {
+        const FrameRecord& record = window[i];
+        for (int stage = 0; stage < NUM_STAGES; stage++)
+            stage_sum[stage] += record.ticks[stage];
+        total_sum += record.total;
+        if (record.total < total_min) total_min = record.total;
+        if (record.total > total_max) total_max = record.total;
+    }
+
+    std::string text = Common::FormatString(
+        "fill %.2f text %.2f hud %.2f swap %.2f ms\n"
+        "min %.2f avg %.2f max %.2f ms  miss %lu\n",
+        ToMilliseconds(stage_sum[STAGE_FILL] / window_count),
+        ToMilliseconds(stage_sum[STAGE_TEXT] / window_count),
+        ToMilliseconds(stage_sum[STAGE_HUD] / window_count),
+        ToMilliseconds(stage_sum[STAGE_PRESENT] / window_count),
+        ToMilliseconds(total_min), ToMilliseconds(total_sum / window_count),
+        ToMilliseconds(total_max), missed_vblanks);
+
+    static font_s hud_font = fontDefault;
+    hud_font.color[0] = 0xFF;
+    hud_font.color[1] = 0xCC;
+    hud_font.color[2] = 0x00;
+
+    Rect screen_size = GetScreenSize(GFX_BOTTOM);
+    DrawText(GFX_BOTTOM, GFX_LEFT, &hud_font, text, screen_size.h - hud_font.height, 4);
+}
+
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <3ds.h>
+
+namespace HUD {
+
+/// Stages of DrawBuffers that are timed separately.
+enum Stage {
+    STAGE_FILL,    ///< FillScreen on both screens
+    STAGE_TEXT,    ///< Text pass on both screens
+    STAGE_HUD,     ///< Drawing the overlay itself
+    STAGE_PRESENT, ///< gfxFlushBuffers + gfxSwapBuffers
+    NUM_STAGES
+};
+
+bool IsEnabled();
+void SetEnabled(bool enabled);
+
+/**
+ * Times the stages of one frame, and counts it as presented for WaitForVBlank. Times nothing
+ * unless the HUD is enabled, in which case the costs are recorded when the timer goes out of scope.
+ */
+class FrameTimer {
+public:
+    FrameTimer();
+    ~FrameTimer();
+
+    /// Adds the time elapsed since the previous lap to `stage`.
+    void Lap(Stage stage);
+
+private:
+    bool enabled;
+    u64 last;
+    u64 ticks[NUM_STAGES];
+};
+
+/// Draws the overlay onto the top rows of the bottom screen, which the text buffer never uses.
+void Draw();
+
+/**
+ * Waits for the next VBlank, for the idle loops that draw one frame per refresh. A VBlank that
+ * passed without the loop presenting a frame counts as missed. Stretches in which more than one
+ * frame was presented are not paced by VBlanks, such as tests printing, and are not counted.
+ */
+void WaitForVBlank();
+
+}
@@ -1,23 +1,104 @@
 #include <3ds.h>
 
+#include "hud.h"
 #include "output.h"
+#include "results_board.h"
+#include "stream.h"
+#include "common/string_funcs.h"
+#include "common/timer.h"
+#include "tests/heap_tracker.h"
+#include "tests/scheduler.h"
 #include "tests/test.h"
+#include "tests/watchdog.h"
 #include "tests/fs/fs.h"
 #include "tests/cpu/cputests.h"
+#include "tests/gpu/gputests.h"
+#include "tests/kernel/kerneltests.h"
+
+// Lines scrolled by L/R in the history view
+static const int HISTORY_PAGE_LINES = 10;
+// Circle pad deflection below which the history view does not scroll
+static const int CIRCLE_DEADZONE = 24;
 
 static unsigned int test_counter = 0;
-static TestCaller tests[] = {
-    FS::TestAll,
-    CPU::Integer::TestAll
+static const TestGroup tests[] = {
+    { FS::TestAll,                false },
+    { CPU::Integer::TestAll,      true  },
+    { CPU::MediaSweep::TestAll,   true  },
+    { CPU::FlagSetting::TestAll,  true  },
+    { CPU::Vfp::TestAll,          false },
+    { CPU::Vectors::TestAll,      false },
+    { CPU::Atomics::TestAll,      false },
+    { CPU::Branch::TestAll,       false },
+    { CPU::Memory::TestAll,       false },
+    { GPU::Transfer::TestAll,     false },
+    { Kernel::Threading::TestAll, false },
+};
+static const unsigned int num_tests = sizeof(tests) / sizeof(tests[0]);
+
+// Logged after every group, so growth over long runs shows up in the log
+static void LogMemoryTotals()
+{
+    HeapTracker::CaseStats totals = HeapTracker::GetTotals();
+    LogInfo("MEMORY: heap %d B live, peak %d B, %u allocations; linear %d B live, peak %d B\n",
+            (int)totals.heap.net_bytes, (int)totals.heap.peak_bytes, (unsigned)totals.heap.allocations,
+            (int)totals.linear.net_bytes, (int)totals.linear.peak_bytes);
+}
+
+// Scrolls whichever view is on the top screen, towards older output if `lines` is positive
+static void Scroll(int lines)
+{
+    if (ResultsBoard::IsEnabled())
+        ResultsBoard::Scroll(lines);
+    else
+        ScrollHistory(lines);
+}
+
+// Waits for the background part of InitOutput before a group runs, and logs its cost once
+static void WaitForOutput()
+{
+    static bool logged = false;
+    WaitForStorage();
+    if (logged)
+        return;
+
+    logged = true;
+    BackgroundInitTimes times = GetBackgroundInitTimes();
+    LogInfo("STARTUP: in the background, stream %llu us, SD card and log file %llu us\n",
+            Common::TicksToMicroseconds(times.stream_ticks), Common::TicksToMicroseconds(times.storage_ticks));
+}
+
+// Startup stages, in microseconds since the previous one, for the STARTUP line
+struct StartupTimer {
+    u64 last = svcGetSystemTick();
+    u64 total = 0;
+
+    u64 Lap()
+    {
+        u64 now = svcGetSystemTick();
+        u64 elapsed = Common::TicksToMicroseconds(now - last);
+        last = now;
+        total += elapsed;
+        return elapsed;
+    }
 };
 
 int main(int argc, char** argv)
 {
+    StartupTimer startup;
     gfxInitDefault();
-    InitOutput();
+    u64 gfx_us = startup.Lap();
+    // Text output does not need exact colors, so trade them for half the fill bandwidth
+    InitOutput(GSP_RGB565_OES);
+    u64 output_us = startup.Lap();
+    Watchdog::Start();
+    u64 watchdog_us = startup.Lap();
 
-    ClearScreens();
+    // Print draws and presents a whole frame, so the screens need no clearing first
     Print(GFX_TOP, "Press A to begin...\n");
+    u64 frame_us = startup.Lap();
+    LogInfo("STARTUP: first frame %llu us after main (gfx %llu us, output %llu us, watchdog %llu us, "
+            "frame %llu us)\n", startup.total, gfx_us, output_us, watchdog_us, frame_us);
 
     while (aptMainLoop()) {
         DrawBuffers();
@@ -25,23 +106,64 @@ int main(int argc, char** argv)
         hidScanInput();
         if (hidKeysDown() & KEY_START) {
             break;
+        } else if (hidKeysDown() & KEY_SELECT) {
+            HUD::SetEnabled(!HUD::IsEnabled());
+        } else if (hidKeysDown() & KEY_X) {
+            ResultsBoard::SetEnabled(!ResultsBoard::IsEnabled());
+        } else if (hidKeysDown() & KEY_B) {
+            ResetHistoryScroll();
+        } else if (hidKeysDown() & (KEY_DUP | KEY_DDOWN | KEY_L | KEY_R)) {
+            if (hidKeysDown() & KEY_DUP)   Scroll(1);
+            if (hidKeysDown() & KEY_DDOWN) Scroll(-1);
+            if (hidKeysDown() & KEY_L)     Scroll(HISTORY_PAGE_LINES);
+            if (hidKeysDown() & KEY_R)     Scroll(-HISTORY_PAGE_LINES);
         } else if (hidKeysDown() & KEY_A) {
+            ResetHistoryScroll();
             ClearScreens();
+            WaitForOutput();
 
-            if (test_counter < (sizeof(tests) / sizeof(tests[0]))) {
-                tests[test_counter]();
+            if (test_counter < num_tests) {
+                tests[test_counter].caller();
                 test_counter++;
+                LogMemoryTotals();
+                FlushLog();
             } else {
                 break;
             }
 
             Log(GFX_TOP, "\n");
             Print(GFX_TOP, "Press A to continue...\n");
+        } else if (hidKeysDown() & KEY_Y) {
+            ResetHistoryScroll();
+            ClearScreens();
+            WaitForOutput();
+
+            if (test_counter == num_tests)
+                break;
+
+            // Everything left, with parallel-safe groups spread over both cores
+            u64 start = svcGetSystemTick();
+            RunTestGroups(&tests[test_counter], num_tests - test_counter);
+            test_counter = num_tests;
+            LogMemoryTotals();
+
+            Log(GFX_TOP, "\n");
+            Print(GFX_TOP, Common::FormatString("Finished in %llu ms. Press START to exit...\n",
+                                                Common::TicksToMicroseconds(svcGetSystemTick() - start) / 1000));
         }
 
-        gspWaitForEvent(GSPEVENT_VBlank0, false);
+        circlePosition circle;
+        hidCircleRead(&circle);
+        if (circle.dy > CIRCLE_DEADZONE || circle.dy < -CIRCLE_DEADZONE)
+            Scroll(circle.dy / CIRCLE_DEADZONE);
+
+        // Once a frame while idle keeps the host up to date; Print draws a frame per line, so
+        // flushing from DrawBuffers would cost a send per line
+        Stream::Flush();
+        HUD::WaitForVBlank();
     }
 
+    Watchdog::Stop();
     ClearScreens();
     
     gfxExit();
@@ -2,17 +2,57 @@
 
 #include "output.h"
 
+#include <algorithm>
 #include <cmath>
 #include <fstream>
 
 #include "draw.h"
+#include "hud.h"
+#include "results_board.h"
+#include "stream.h"
+#include "common/line_history.h"
 #include "common/string_funcs.h"
+#include "common/thread.h"
+#include "common/timer.h"
 
 static FILE* log_file;
 
+// Connects the host stream, mounts the SD card and opens the log file, so the first frame waits
+// for neither the network nor the card
+static Common::Thread* storage_thread;
+// Set by the storage thread once it is done, whether or not the log file could be opened
+static bool storage_ready = false;
+// File output logged before then, written to the file and the stream as soon as they are ready
+static std::string pending_file_text;
+static BackgroundInitTimes background_times;
+
+// Font override loaded by the storage thread, swapped in by the next DrawBuffers
+static font_s loaded_font;
+static volatile bool font_pending = false;
+
+// Serialises all output functions. Log calls Print with it held, which relies on recursion.
+static Common::Mutex output_mutex;
+
+struct CaptureSlot {
+    u32 thread_id;
+    CapturedOutput* output;
+};
+
+static CaptureSlot capture_slots[4];
+static int active_captures = 0;
+
+static LogLevel sink_levels[NUM_LOG_SINKS] = { LOG_LEVEL_NONE, LOG_LEVEL_INFO, LOG_LEVEL_INFO };
+// Lowest level any sink takes, so filtered messages are rejected with a single comparison
+static LogLevel lowest_enabled_level = LOG_LEVEL_INFO;
+
 static std::string buffer_top;
 static std::string buffer_bottom;
 
+// Everything printed to the top screen, for the scrollback viewer
+static Common::LineHistory history_top(10000, 512 * 1024);
+// Number of lines the top screen view is scrolled back from the newest output
+static size_t history_scroll = 0;
+
 static std::string& GetTextBuffer(gfxScreen_t screen)
 {
     switch (screen) {
@@ -22,71 +62,398 @@ static std::string& GetTextBuffer(gfxScreen_t screen)
     return buffer_top;
 }
 
+static int GetVisibleLines(gfxScreen_t screen)
+{
+    return GetScreenSize(screen).h / fontDefault.height - 3;
+}
+
+static size_t GetMaxHistoryScroll()
+{
+    size_t visible = GetVisibleLines(GFX_TOP);
+    return (history_top.Count() > visible) ? history_top.Count() - visible : 0;
+}
+
+static void DrawHistory()
+{
+    Rect screen_size = GetScreenSize(GFX_TOP);
+    size_t end = history_top.Count() - history_scroll;
+    size_t begin = (end > (size_t)GetVisibleLines(GFX_TOP)) ? end - GetVisibleLines(GFX_TOP) : 0;
+
+    // Only the lines in view are gathered, so the cost does not depend on the history size
+    std::string text;
+    for (size_t i = begin; i < end; i++) {
+        size_t length;
+        const char* line = history_top.GetLine(i, &length);
+        text.append(line, length);
+        text += '\n';
+    }
+    DrawText(GFX_TOP, GFX_LEFT, nullptr, text, screen_size.h - fontDefault.height * 3, 10);
+
+    size_t first_number = history_top.Dropped() + begin + 1;
+    size_t total = history_top.Dropped() + history_top.Count();
+    std::string status = Common::FormatString("History: lines %u-%u of %u (B to return)",
+                                              (unsigned)first_number,
+                                              (unsigned)(first_number + (end - begin) - 1),
+                                              (unsigned)total);
+    DrawText(GFX_TOP, GFX_LEFT, nullptr, status, screen_size.h - fontDefault.height, 10);
+}
+
 static void DrawBuffer(gfxScreen_t screen)
 {
+    if (screen == GFX_TOP && history_scroll > 0) {
+        DrawHistory();
+        return;
+    }
+
     Rect screen_size = GetScreenSize(screen);
     std::string& text_buffer = GetTextBuffer(screen);
 
     int lines = Common::CountLines(text_buffer);
-    while (lines > (screen_size.h / fontDefault.height - 3)) {
+    while (lines > GetVisibleLines(screen)) {
         Common::DeleteFirstLine(&text_buffer);
         lines--;
     }
     DrawText(screen, GFX_LEFT, nullptr, text_buffer, screen_size.h - fontDefault.height * 3, 10);
 }
 
-void InitOutput()
+// Allocates while the main thread draws, which the allocator lock in common/thread.cpp makes safe.
+// It must not print, as only the main thread draws.
+static void OpenStorage(void*)
 {
+    u64 start = svcGetSystemTick();
+    Stream::Init();
+    u64 stream_done = svcGetSystemTick();
+    background_times.stream_ticks = stream_done - start;
+
     sdmcInit();
-    log_file = fopen("hwtest_log.txt", "w");
+    FILE* file = fopen("hwtest_log.txt", "w");
+
+    // Optional font override, so fonts can be tried out without rebuilding
+    font_s font = fontDefault;
+    if (LoadFontFile(&font, "hwtest_font.bin")) {
+        loaded_font = font;
+        __sync_synchronize();
+        font_pending = true;
+    }
+
+    {
+        Common::LockGuard lock(output_mutex);
+        log_file = file;
+        if (log_file)
+            fwrite(pending_file_text.data(), 1, pending_file_text.size(), log_file);
+        Stream::Write(pending_file_text);
+        std::string().swap(pending_file_text);
+        storage_ready = true;
+        background_times.storage_ticks = svcGetSystemTick() - stream_done;
+    }
+}
+
+void InitOutput(GSP_FramebufferFormats format)
+{
+    SetScreenFormat(GFX_TOP, format);
+    SetScreenFormat(GFX_BOTTOM, format);
+
+    // Below our priority, so it only runs while the main thread waits for the screen or input
+    storage_thread = new Common::Thread(OpenStorage, nullptr, Common::GetCurrentThreadPriority() + 1,
+                                        Common::CORE_APP);
+    if (!storage_thread->IsValid()) {
+        delete storage_thread;
+        storage_thread = nullptr;
+        OpenStorage(nullptr);
+    }
+}
+
+void WaitForStorage()
+{
+    if (!storage_thread)
+        return;
+
+    storage_thread->Join();
+    delete storage_thread;
+    storage_thread = nullptr;
+}
+
+BackgroundInitTimes GetBackgroundInitTimes()
+{
+    return background_times;
 }
 
 void DrawBuffers()
 {
-    FillScreen(GFX_TOP, 0x00, 0x66, 0x88);
-    DrawBuffer(GFX_TOP);
+    if (font_pending) {
+        fontDefault = loaded_font;
+        font_pending = false;
+    }
+
+    HUD::FrameTimer timer;
+
+    if (ResultsBoard::IsEnabled()) {
+        ResultsBoard::Draw();
+        timer.Lap(HUD::STAGE_TEXT);
+    } else {
+        FillScreen(GFX_TOP, 0x00, 0x66, 0x88);
+        timer.Lap(HUD::STAGE_FILL);
+        DrawBuffer(GFX_TOP);
+        timer.Lap(HUD::STAGE_TEXT);
+    }
     
     FillScreen(GFX_BOTTOM, 0x00, 0x00, 0x00);
+    timer.Lap(HUD::STAGE_FILL);
     DrawBuffer(GFX_BOTTOM);
+    timer.Lap(HUD::STAGE_TEXT);
+
+    HUD::Draw();
+    timer.Lap(HUD::STAGE_HUD);
     
     gfxFlushBuffers();
     gfxSwapBuffers();
+    timer.Lap(HUD::STAGE_PRESENT);
 }
 
-void ClearScreen(gfxScreen_t screen, u8 bg_r, u8 bg_g, u8 bg_b)
+// Clears `screen` in the back buffer, without presenting it
+static void ClearBuffer(gfxScreen_t screen, u8 bg_r, u8 bg_g, u8 bg_b)
 {
     FillScreen(screen, bg_r, bg_g, bg_b);
     GetTextBuffer(screen).clear();
+    if (screen == GFX_TOP)
+        ResultsBoard::Invalidate();
+}
+
+void ClearScreen(gfxScreen_t screen, u8 bg_r, u8 bg_g, u8 bg_b)
+{
+    ClearBuffer(screen, bg_r, bg_g, bg_b);
     gfxFlushBuffers();
     gfxSwapBuffers();
 }
 
 void ClearScreens()
 {
-    ClearScreen(GFX_TOP, 0x00, 0x66, 0x88);
-    ClearScreen(GFX_BOTTOM, 0x00, 0x00, 0x00);
+    // Both screens in one present, which is half the cost of clearing them one at a time
+    ClearBuffer(GFX_TOP, 0x00, 0x66, 0x88);
+    ClearBuffer(GFX_BOTTOM, 0x00, 0x00, 0x00);
+    gfxFlushBuffers();
+    gfxSwapBuffers();
+}
+
+void ScrollHistory(int lines)
+{
+    if (lines < 0)
+        history_scroll -= std::min(history_scroll, (size_t)-lines);
+    else
+        history_scroll = std::min(history_scroll + lines, GetMaxHistoryScroll());
+}
+
+void ResetHistoryScroll()
+{
+    history_scroll = 0;
+}
+
+static u32 GetCurrentThreadId()
+{
+    u32 id = 0;
+    svcGetThreadId(&id, CUR_THREAD_HANDLE);
+    return id;
+}
+
+// Must be called with output_mutex held
+static CapturedOutput* GetCapture()
+{
+    if (active_captures == 0)
+        return nullptr;
+
+    u32 id = GetCurrentThreadId();
+    for (const CaptureSlot& slot : capture_slots) {
+        if (slot.output && slot.thread_id == id)
+            return slot.output;
+    }
+    return nullptr;
+}
+
+// Records the output in the calling thread's capture, if it has one
+static bool Capture(CapturedOutput::Kind kind, gfxScreen_t screen, const std::string& text,
+                    LogLevel level = LOG_LEVEL_NONE)
+{
+    CapturedOutput* output = GetCapture();
+    if (!output)
+        return false;
+
+    // Merge with the previous entry where possible, so captures stay short
+    if (!output->entries.empty()) {
+        CapturedOutput::Entry& last = output->entries.back();
+        if (last.kind == kind && last.screen == screen && last.level == level) {
+            last.text += text;
+            return true;
+        }
+    }
+    output->entries.push_back({ kind, screen, text, level });
+    return true;
+}
+
+void BeginCapture()
+{
+    Common::LockGuard lock(output_mutex);
+    for (CaptureSlot& slot : capture_slots) {
+        if (!slot.output) {
+            slot.thread_id = GetCurrentThreadId();
+            slot.output = new CapturedOutput;
+            active_captures++;
+            return;
+        }
+    }
+}
+
+CapturedOutput EndCapture()
+{
+    Common::LockGuard lock(output_mutex);
+    CapturedOutput result;
+    u32 id = GetCurrentThreadId();
+    for (CaptureSlot& slot : capture_slots) {
+        if (slot.output && slot.thread_id == id) {
+            result = std::move(*slot.output);
+            delete slot.output;
+            slot.output = nullptr;
+            active_captures--;
+            break;
+        }
+    }
+    return result;
+}
+
+bool IsCapturing()
+{
+    Common::LockGuard lock(output_mutex);
+    return GetCapture() != nullptr;
+}
+
+void ReplayOutput(const CapturedOutput& output)
+{
+    for (const CapturedOutput::Entry& entry : output.entries) {
+        switch (entry.kind) {
+            case CapturedOutput::PRINT:       Print(entry.screen, entry.text); break;
+            case CapturedOutput::LOG:         Log(entry.screen, entry.text); break;
+            case CapturedOutput::LOG_TO_FILE: LogToFile(entry.text); break;
+            case CapturedOutput::MESSAGE:     LogMessage(entry.level, entry.text); break;
+        }
+    }
 }
 
 void Print(gfxScreen_t screen, const std::string& text)
 {
+    Common::LockGuard lock(output_mutex);
+    if (Capture(CapturedOutput::PRINT, screen, text))
+        return;
+
     GetTextBuffer(screen) += text;
+    if (screen == GFX_TOP)
+        history_top.Append(text);
     DrawBuffers();
 }
 
 void Log(gfxScreen_t screen, const std::string& text)
 {
+    Common::LockGuard lock(output_mutex);
+    if (Capture(CapturedOutput::LOG, screen, text))
+        return;
+
     Print(screen, text);
     LogToFile(text);
 }
 
+// Must be called with output_mutex held
+static void WriteToFile(const std::string& text)
+{
+    if (!storage_ready) {
+        pending_file_text += text;
+        return;
+    }
+    if (log_file)
+        fprintf(log_file, "%s", text.c_str());
+    Stream::Write(text);
+}
+
 void LogToFile(const std::string& text)
 {
+    Common::LockGuard lock(output_mutex);
+    if (Capture(CapturedOutput::LOG_TO_FILE, GFX_TOP, text))
+        return;
+
     svcOutputDebugString(text.c_str(), text.length());
-    fprintf(log_file, "%s", text.c_str());
+    WriteToFile(text);
+}
+
+void SetLogLevel(LogSink sink, LogLevel level)
+{
+    Common::LockGuard lock(output_mutex);
+    sink_levels[sink] = level;
+    lowest_enabled_level = *std::min_element(sink_levels, sink_levels + NUM_LOG_SINKS);
+}
+
+LogLevel GetLogLevel(LogSink sink)
+{
+    return sink_levels[sink];
+}
+
+bool IsLogLevelEnabled(LogLevel level)
+{
+    return level >= lowest_enabled_level;
+}
+
+void LogMessage(LogLevel level, const std::string& text)
+{
+    Common::LockGuard lock(output_mutex);
+    if (Capture(CapturedOutput::MESSAGE, GFX_TOP, text, level))
+        return;
+
+    if (level >= sink_levels[LOG_SINK_DEBUG])
+        svcOutputDebugString(text.c_str(), text.length());
+    if (level >= sink_levels[LOG_SINK_FILE])
+        WriteToFile(text);
+    if (level >= sink_levels[LOG_SINK_SCREEN])
+        Print(GFX_TOP, text);
+}
+
+void FlushLog()
+{
+    Common::LockGuard lock(output_mutex);
+    if (log_file)
+        fflush(log_file);
+    Stream::Flush();
+}
+
+bool TryLogToFile(const std::string& text, u64 timeout_ns)
+{
+    if (!output_mutex.TryLock(timeout_ns))
+        return false;
+
+    svcOutputDebugString(text.c_str(), text.length());
+    WriteToFile(text);
+    if (log_file)
+        fflush(log_file);
+    Stream::Flush();
+    output_mutex.Unlock();
+    return true;
+}
+
+void AbortOutput(const std::string& text, u64 timeout_ns)
+{
+    svcOutputDebugString(text.c_str(), text.length());
+    if (!output_mutex.TryLock(timeout_ns))
+        return;
+
+    // The storage thread is not waited for; output it has not written yet is lost
+    WriteToFile(text);
+    Stream::Deinit();
+    if (log_file)
+        fclose(log_file);
+    log_file = nullptr;
+    output_mutex.Unlock();
 }
 
 void DeinitOutput()
 {
-    fclose(log_file);
+    WaitForStorage();
+    Stream::Deinit();
+    if (log_file)
+        fclose(log_file);
     sdmcExit();
 }
@@ -1,10 +1,30 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include <3ds.h>
 
-void InitOutput();
+#include "common/string_funcs.h"
+
+/**
+ * Sets up the screens and the log file. `format` selects the framebuffer format used for both
+ * screens; see SetScreenFormat for the supported ones. The host stream is connected, the SD card
+ * mounted and the log file opened on a background thread; file output logged until then is kept
+ * and written out after.
+ */
+void InitOutput(GSP_FramebufferFormats format = GSP_BGR8_OES);
+
+/// Waits until the background setup of InitOutput is done. Call before anything uses the card.
+void WaitForStorage();
+
+/// Time the background setup took for each of its stages, in ticks. Valid once WaitForStorage
+/// has returned.
+struct BackgroundInitTimes {
+    u64 stream_ticks;   ///< Connecting the host stream
+    u64 storage_ticks;  ///< Mounting the SD card, opening the log file and loading the font
+};
+BackgroundInitTimes GetBackgroundInitTimes();
 
 void DrawBuffers();
 
@@ -14,9 +34,118 @@ void Print(gfxScreen_t screen, const std::string& text);
 /// Prints `text` to `screen`, and logs it in the log file.
 void Log(gfxScreen_t screen, const std::string& text);
 
-/// Logs `text` to the log file.
+/// Logs `text` to the log file, and streams it to the host if streaming is enabled.
 void LogToFile(const std::string& text);
 
+/// Writes everything logged so far to the card and the host stream, so it survives the process
+/// going away.
+void FlushLog();
+
+/**
+ * LogToFile followed by FlushLog, for the watchdog, whose cases may be stuck in the middle of
+ * output. Gives up and returns false if other output holds the log for longer than `timeout_ns`.
+ */
+bool TryLogToFile(const std::string& text, u64 timeout_ns);
+
+/**
+ * Logs `text` as the final line and closes the log, before the process is ended early. The text
+ * always reaches the debug output; the log file and the host stream are skipped if other output
+ * holds them for longer than `timeout_ns`.
+ */
+void AbortOutput(const std::string& text, u64 timeout_ns);
+
+/// Severity of a diagnostic message, from the most verbose to the most important
+enum LogLevel {
+    LOG_LEVEL_TRACE,
+    LOG_LEVEL_DEBUG,
+    LOG_LEVEL_INFO,
+    LOG_LEVEL_ERROR,
+    LOG_LEVEL_NONE, ///< Only as a sink level: the sink takes no messages
+};
+
+/// Destinations of diagnostic messages, each with its own runtime level
+enum LogSink {
+    LOG_SINK_SCREEN, ///< The top screen
+    LOG_SINK_FILE,   ///< The log file, and the host stream if streaming is enabled
+    LOG_SINK_DEBUG,  ///< svcOutputDebugString, for debuggers and emulators
+    NUM_LOG_SINKS,
+};
+
+// Messages below this level are compiled out; set with `make LOG_LEVEL=TRACE` and the like
+#ifndef LOG_MIN_LEVEL
+#define LOG_MIN_LEVEL LOG_LEVEL_DEBUG
+#endif
+
+/// Makes `sink` take messages of `level` and above. Screen defaults to none, the others to info.
+void SetLogLevel(LogSink sink, LogLevel level);
+LogLevel GetLogLevel(LogSink sink);
+
+/// Returns whether any sink takes messages of `level`.
+bool IsLogLevelEnabled(LogLevel level);
+
+/// Sends `text` to every sink that takes messages of `level`. Use the macros below instead, so
+/// filtered messages are not formatted.
+void LogMessage(LogLevel level, const std::string& text);
+
+/**
+ * Logs a printf-style message at `level`. Below LOG_MIN_LEVEL the condition is constant and the
+ * call compiles to nothing; otherwise the arguments are only evaluated if some sink takes the
+ * message.
+ */
+#define LogAtLevel(level, ...) \
+    do { \
+        if ((level) >= LOG_MIN_LEVEL && IsLogLevelEnabled(level)) \
+            LogMessage((level), Common::FormatString(__VA_ARGS__)); \
+    } while (0)
+
+#define LogTrace(...) LogAtLevel(LOG_LEVEL_TRACE, __VA_ARGS__)
+#define LogDebug(...) LogAtLevel(LOG_LEVEL_DEBUG, __VA_ARGS__)
+#define LogInfo(...)  LogAtLevel(LOG_LEVEL_INFO, __VA_ARGS__)
+#define LogError(...) LogAtLevel(LOG_LEVEL_ERROR, __VA_ARGS__)
+
+/// Output produced by a thread while capturing, in the order it was produced.
+struct CapturedOutput {
+    enum Kind {
+        PRINT,
+        LOG,
+        LOG_TO_FILE,
+        MESSAGE,
+    };
+
+    struct Entry {
+        Kind kind;
+        gfxScreen_t screen;
+        std::string text;
+        LogLevel level; ///< Only for MESSAGE
+    };
+
+    std::vector<Entry> entries;
+};
+
+/**
+ * Makes Print, Log, LogToFile and LogMessage collect everything the calling thread outputs instead of
+ * drawing or writing it, until EndCapture. All output functions may be called from any thread,
+ * but threads other than the main one must be capturing.
+ */
+void BeginCapture();
+CapturedOutput EndCapture();
+
+/// Returns whether the calling thread is capturing its output.
+bool IsCapturing();
+
+/// Outputs everything in `output` as if it had been printed and logged just now.
+void ReplayOutput(const CapturedOutput& output);
+
+/**
+ * Scrolls the top screen back through its output history by `lines` (negative values scroll
+ * towards newer output). While scrolled back, the screen shows the history instead of the live
+ * text buffer.
+ */
+void ScrollHistory(int lines);
+
+/// Returns the top screen to the live output.
+void ResetHistoryScroll();
+
 void ClearScreen(gfxScreen_t screen, u8 bg_r, u8 bg_g, u8 bg_b);
 void ClearScreens();
 
@@ -0,0 +1,237 @@
+#include "results_board.h"
+
+#include <algorithm>
+#include <map>
+#include <vector>
+
+#include <3ds.h>
+
+#include "draw.h"
+#include "font.h"
+#include "common/string_funcs.h"
+#include "common/thread.h"
+
+namespace ResultsBoard {
+
+static const int LABEL_WIDTH = 96;
+static const int LABEL_CHARS = 12;
+static const int CELL_SIZE = 10;
+static const int CELL_PITCH_X = 12;
+static const int ROW_HEIGHT = 16;
+static const int FIRST_ROW_Y = 24;
+static const int CELLS_PER_ROW = (400 - LABEL_WIDTH) / CELL_PITCH_X;
+static const int MAX_ROWS = (240 - FIRST_ROW_Y) / ROW_HEIGHT;
+
+static const u8 BG_COLOR[3] = { 0x00, 0x66, 0x88 };
+static const u8 CELL_COLORS[][3] = {
+    { 0x40, 0x40, 0x40 }, // CELL_SKIPPED
+    { 0xFF, 0xCC, 0x00 }, // CELL_RUNNING
+    { 0x00, 0xCC, 0x44 }, // CELL_PASS
+    { 0xEE, 0x22, 0x22 }, // CELL_FAIL
+};
+
+// The top screen is double buffered, so every change has to reach both framebuffers. Dirty
+// state is kept as a bit per framebuffer.
+static const u8 ALL_BUFFERS = 0x3;
+
+struct Cell {
+    CellState state;
+    u8 dirty;
+};
+
+struct Group {
+    std::string name;
+    std::vector<int> rows;
+    std::vector<Cell> cells;
+    std::map<std::string, size_t> cell_index;
+    u8 label_dirty;
+};
+
+static bool enabled = false;
+
+// Test cases may report from worker threads while the main thread draws
+static Common::Mutex board_mutex;
+
+static std::vector<Group> groups;
+static std::map<std::string, size_t> group_index;
+static int rows_used = 0;
+// First row in view, once there are more rows than MAX_ROWS
+static int first_row = 0;
+
+static u8* framebuffers[2] = { nullptr, nullptr };
+static u8 full_repaint = ALL_BUFFERS;
+
+bool IsEnabled()
+{
+    return enabled;
+}
+
+void SetEnabled(bool enable)
+{
+    if (enable && !enabled)
+        Invalidate();
+    enabled = enable;
+}
+
+void Invalidate()
+{
+    Common::LockGuard lock(board_mutex);
+    full_repaint = ALL_BUFFERS;
+}
+
+static int GetMaxFirstRow()
+{
+    return std::max(rows_used - MAX_ROWS, 0);
+}
+
+void Scroll(int rows)
+{
+    Common::LockGuard lock(board_mutex);
+    int new_first_row = std::min(std::max(first_row - rows, 0), GetMaxFirstRow());
+    if (new_first_row != first_row) {
+        first_row = new_first_row;
+        full_repaint = ALL_BUFFERS;
+    }
+}
+
+// Hands out a new row, scrolling along with it if the view was showing the last row
+static int AddRow()
+{
+    bool following = (first_row == GetMaxFirstRow());
+    int row = rows_used++;
+    if (rows_used > MAX_ROWS) {
+        if (following)
+            first_row = GetMaxFirstRow();
+        // The header shows the rows in view
+        full_repaint = ALL_BUFFERS;
+    }
+    return row;
+}
+
+static Group& GetGroup(const std::string& name)
+{
+    auto it = group_index.find(name);
+    if (it != group_index.end())
+        return groups[it->second];
+
+    group_index[name] = groups.size();
+    groups.emplace_back();
+    Group& group = groups.back();
+    group.name = name;
+    group.label_dirty = ALL_BUFFERS;
+    return group;
+}
+
+void SetCaseState(const std::string& group_name, const std::string& name, CellState state)
+{
+    Common::LockGuard lock(board_mutex);
+    Group& group = GetGroup(group_name);
+
+    auto it = group.cell_index.find(name);
+    if (it == group.cell_index.end()) {
+        // Rows are handed out on demand so that groups may grow in any order
+        if (group.cells.size() % CELLS_PER_ROW == 0)
+            group.rows.push_back(AddRow());
+        it = group.cell_index.insert({ name, group.cells.size() }).first;
+        group.cells.push_back({ state, ALL_BUFFERS });
+        return;
+    }
+
+    Cell& cell = group.cells[it->second];
+    if (cell.state != state) {
+        cell.state = state;
+        cell.dirty = ALL_BUFFERS;
+    }
+}
+
+static int GetBufferIndex(u8* fb)
+{
+    for (int i = 0; i < 2; i++) {
+        if (framebuffers[i] == fb)
+            return i;
+    }
+    for (int i = 0; i < 2; i++) {
+        if (framebuffers[i] == nullptr) {
+            framebuffers[i] = fb;
+            full_repaint |= 1 << i;
+            return i;
+        }
+    }
+
+    // The framebuffers were reallocated; start over
+    framebuffers[0] = fb;
+    framebuffers[1] = nullptr;
+    full_repaint = ALL_BUFFERS;
+    return 0;
+}
+
+/// Returns whether `row` is in view, and its position on the screen if it is.
+static bool GetRowY(int row, int* y)
+{
+    if (row < first_row || row >= first_row + MAX_ROWS)
+        return false;
+    *y = FIRST_ROW_Y + (row - first_row) * ROW_HEIGHT;
+    return true;
+}
+
+static void DrawLabel(const Group& group)
+{
+    Rect screen_size = GetScreenSize(GFX_TOP);
+    int y;
+    if (!GetRowY(group.rows[0], &y))
+        return;
+    FillRect(GFX_TOP, 0, y, LABEL_WIDTH, ROW_HEIGHT, BG_COLOR[0], BG_COLOR[1], BG_COLOR[2]);
+    DrawText(GFX_TOP, GFX_LEFT, nullptr, group.name.substr(0, LABEL_CHARS),
+             screen_size.h - y - fontDefault.height, 4);
+}
+
+static void DrawCell(const Group& group, size_t index)
+{
+    int y;
+    if (!GetRowY(group.rows[index / CELLS_PER_ROW], &y))
+        return;
+    int x = LABEL_WIDTH + (index % CELLS_PER_ROW) * CELL_PITCH_X;
+    y += (ROW_HEIGHT - CELL_SIZE) / 2;
+    const u8* color = CELL_COLORS[group.cells[index].state];
+    FillRect(GFX_TOP, x, y, CELL_SIZE, CELL_SIZE, color[0], color[1], color[2]);
+}
+
+void Draw()
+{
+    if (!enabled)
+        return;
+
+    Common::LockGuard lock(board_mutex);
+    u8 buffer_bit = 1 << GetBufferIndex(gfxGetFramebuffer(GFX_TOP, GFX_LEFT, nullptr, nullptr));
+    bool full = (full_repaint & buffer_bit) != 0;
+    full_repaint &= ~buffer_bit;
+
+    if (full) {
+        Rect screen_size = GetScreenSize(GFX_TOP);
+        FillScreen(GFX_TOP, BG_COLOR[0], BG_COLOR[1], BG_COLOR[2]);
+        std::string header = "Results board (X to return to the log)";
+        if (rows_used > MAX_ROWS) {
+            header = Common::FormatString("Results board, rows %d-%d of %d (D-pad to scroll)",
+                                          first_row + 1, first_row + MAX_ROWS, rows_used);
+        }
+        DrawText(GFX_TOP, GFX_LEFT, nullptr, header, screen_size.h - fontDefault.height - 2, 4);
+    }
+
+    for (Group& group : groups) {
+        if (group.rows.empty())
+            continue;
+
+        if (full || (group.label_dirty & buffer_bit))
+            DrawLabel(group);
+        group.label_dirty &= ~buffer_bit;
+
+        for (size_t i = 0; i < group.cells.size(); i++) {
+            Cell& cell = group.cells[i];
+            if (full || (cell.dirty & buffer_bit))
+                DrawCell(group, i);
+            cell.dirty &= ~buffer_bit;
+        }
+    }
+}
+
+}
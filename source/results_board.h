@@ -0,0 +1,39 @@
+#pragma once
+
+#include <string>
+
+#include <3ds.h>
+
+/**
+ * Alternative presentation of the top screen: one coloured cell per test case, one row of cells
+ * per test group. Cells keep their position for the whole run, and a state change only repaints
+ * the affected cell.
+ */
+namespace ResultsBoard {
+
+enum CellState {
+    CELL_SKIPPED,   ///< Not run, as an earlier case of the group timed out
+    CELL_RUNNING,
+    CELL_PASS,
+    CELL_FAIL,
+};
+
+bool IsEnabled();
+void SetEnabled(bool enabled);
+
+/// Sets the state of test case `name` in `group`, adding a cell for it if it is new.
+void SetCaseState(const std::string& group, const std::string& name, CellState state);
+
+/// Forces a full repaint, for when something else has drawn over the top screen.
+void Invalidate();
+
+/**
+ * Scrolls the board by `rows`, towards the first groups if positive, when it has more rows than
+ * fit on the screen. While the view shows the last row it follows new rows as they are added.
+ */
+void Scroll(int rows);
+
+/// Paints everything that changed since the current top framebuffer was last drawn.
+void Draw();
+
+}
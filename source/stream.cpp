@@ -0,0 +1,162 @@
+#include "stream.h"
+
+#include <3ds.h>
+
+#ifdef STREAM_HOST
+#include <cerrno>
+#include <fcntl.h>
+#include <malloc.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+#include "common/thread.h"
+#endif
+
+namespace Stream {
+
+#ifdef STREAM_HOST
+
+#ifndef STREAM_PORT
+#define STREAM_PORT 9001
+#endif
+
+static const u32 SOC_BUFFER_SIZE = 0x100000;
+// Queued text is sent once it reaches this size, so short lines do not each cost a send
+static const size_t BATCH_SIZE = 4096;
+// An unreachable host would otherwise hold the run up for the whole TCP connect timeout
+static const u32 CONNECT_TIMEOUT_MS = 2000;
+static const u32 CONNECT_POLL_MS = 10;
+
+static Common::Mutex stream_mutex;
+static u32* soc_buffer;
+static int sock = -1;
+static std::string pending;
+
+static void Close()
+{
+    closesocket(sock);
+    sock = -1;
+    pending.clear();
+}
+
+// Must be called with stream_mutex held
+static void SendPending()
+{
+    size_t sent = 0;
+    while (sent < pending.size()) {
+        int result = send(sock, pending.data() + sent, pending.size() - sent, 0);
+        if (result <= 0) {
+            // The host went away; the log file still has everything
+            Close();
+            return;
+        }
+        sent += result;
+    }
+    pending.clear();
+}
+
+// Connects without blocking, polling until the connection is made or the timeout expires
+static bool Connect(int fd, const sockaddr_in& address)
+{
+    int flags = fcntl(fd, F_GETFL, 0);
+    fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+
+    bool connected = false;
+    for (u32 waited = 0; ; waited += CONNECT_POLL_MS) {
+        if (connect(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0 || errno == EISCONN) {
+            connected = true;
+            break;
+        }
+        if ((errno != EINPROGRESS && errno != EALREADY) || waited >= CONNECT_TIMEOUT_MS)
+            break;
+        svcSleepThread((u64)CONNECT_POLL_MS * 1000 * 1000);
+    }
+
+    // Sends block again, so a full socket buffer delays the log rather than dropping it
+    fcntl(fd, F_SETFL, flags);
+    return connected;
+}
+
+void Init()
+{
+    soc_buffer = static_cast<u32*>(memalign(0x1000, SOC_BUFFER_SIZE));
+    if (!soc_buffer)
+        return;
+    if (SOC_Initialize(soc_buffer, SOC_BUFFER_SIZE) != 0) {
+        free(soc_buffer);
+        soc_buffer = nullptr;
+        return;
+    }
+
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0)
+        return;
+
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(STREAM_PORT);
+    address.sin_addr.s_addr = inet_addr(STREAM_HOST);
+    if (!Connect(fd, address)) {
+        closesocket(fd);
+        return;
+    }
+
+    // Init may run on a background thread, so the socket is only published once it is connected
+    Common::LockGuard lock(stream_mutex);
+    sock = fd;
+}
+
+void Deinit()
+{
+    {
+        Common::LockGuard lock(stream_mutex);
+        if (sock >= 0) {
+            SendPending();
+            if (sock >= 0)
+                Close();
+        }
+    }
+
+    if (soc_buffer) {
+        SOC_Shutdown();
+        free(soc_buffer);
+        soc_buffer = nullptr;
+    }
+}
+
+bool IsActive()
+{
+    Common::LockGuard lock(stream_mutex);
+    return sock >= 0;
+}
+
+void Write(const std::string& text)
+{
+    Common::LockGuard lock(stream_mutex);
+    if (sock < 0)
+        return;
+
+    pending += text;
+    if (pending.size() >= BATCH_SIZE)
+        SendPending();
+}
+
+void Flush()
+{
+    Common::LockGuard lock(stream_mutex);
+    if (sock >= 0 && !pending.empty())
+        SendPending();
+}
+
+#else
+
+void Init() {}
+void Deinit() {}
+bool IsActive() { return false; }
+void Write(const std::string&) {}
+void Flush() {}
+
+#endif
+
+}
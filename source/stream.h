@@ -0,0 +1,27 @@
+#pragma once
+
+#include <string>
+
+/**
+ * Streams the log to a host over TCP, for `send-exec.py --receive`. Only built in when the
+ * Makefile is given STREAM_HOST; otherwise every function does nothing.
+ */
+namespace Stream {
+
+/// Connects to the host, giving up after two seconds. If that fails, the run goes on without
+/// streaming. Safe to call from a thread other than the one writing.
+void Init();
+
+/// Closes the connection after sending everything still pending.
+void Deinit();
+
+/// Returns whether the log is being streamed.
+bool IsActive();
+
+/// Queues `text` to be sent. Text is sent in batches, once enough has been queued or on Flush.
+void Write(const std::string& text);
+
+/// Sends everything queued so far.
+void Flush();
+
+}
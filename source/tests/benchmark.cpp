@@ -0,0 +1,96 @@
+#include "tests/benchmark.h"
+
+#include <algorithm>
+
+#include "output.h"
+#include "common/string_funcs.h"
+#include "common/timer.h"
+
+namespace Benchmark {
+
+float MiBPerSecond(u64 bytes, u64 ticks)
+{
+    if (ticks == 0)
+        return 0.0f;
+    return (float)bytes / (1024.0f * 1024.0f) * Common::TICKS_PER_SECOND / ticks;
+}
+
+std::string FormatMicroseconds(u64 ticks)
+{
+    u64 hundredths = ticks * 100000000ULL / Common::TICKS_PER_SECOND;
+    return Common::FormatString("%llu.%02llu", hundredths / 100, hundredths % 100);
+}
+
+std::string FormatSize(u32 bytes)
+{
+    if (bytes >= 1024 * 1024 && bytes % (1024 * 1024) == 0)
+        return Common::FormatString("%uM", (unsigned)(bytes / (1024 * 1024)));
+    if (bytes >= 1024 && bytes % 1024 == 0)
+        return Common::FormatString("%uK", (unsigned)(bytes / 1024));
+    return Common::FormatString("%u", (unsigned)bytes);
+}
+
+std::string CaseName(const std::vector<std::string>& labels)
+{
+    if (labels.empty())
+        return std::string();
+
+    std::string name = labels[0];
+    for (size_t i = 1; i < labels.size(); i++)
+        name += (i == 1 ? " (" : ", ") + labels[i];
+    if (labels.size() > 1)
+        name += ")";
+    return name;
+}
+
+std::vector<std::string> LatencyCells(const Samples& samples)
+{
+    return { FormatMicroseconds(samples.Average()), FormatMicroseconds(samples.min),
+             FormatMicroseconds(samples.max) };
+}
+
+Table::Table(const std::string& title, std::initializer_list<std::string> columns)
+    : title(title)
+{
+    rows.emplace_back(columns);
+}
+
+Table::Table(const std::string& title, std::vector<std::string> columns)
+    : title(title)
+{
+    rows.push_back(std::move(columns));
+}
+
+void Table::AddRow(std::initializer_list<std::string> cells)
+{
+    rows.emplace_back(cells);
+}
+
+void Table::AddRow(std::vector<std::string> cells)
+{
+    rows.push_back(std::move(cells));
+}
+
+void Table::Log() const
+{
+    std::vector<size_t> widths;
+    for (const auto& row : rows) {
+        widths.resize(std::max(widths.size(), row.size()));
+        for (size_t i = 0; i < row.size(); i++)
+            widths[i] = std::max(widths[i], row[i].length());
+    }
+
+    std::string text = title + "\n";
+    for (const auto& row : rows) {
+        std::string line;
+        for (size_t i = 0; i < row.size(); i++) {
+            line += row[i];
+            if (i + 1 < row.size())
+                line += std::string(widths[i] - row[i].length() + 2, ' ');
+        }
+        text += line + "\n";
+    }
+    ::Log(GFX_TOP, text);
+}
+
+}
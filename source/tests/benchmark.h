@@ -0,0 +1,111 @@
+#pragma once
+
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+#include <3ds.h>
+
+#include "tests/test.h"
+
+namespace Benchmark {
+
+/// Measures elapsed time with the system tick counter.
+class Timer {
+public:
+    Timer() : start(svcGetSystemTick()) {}
+
+    void Restart() { start = svcGetSystemTick(); }
+    u64 Elapsed() const { return svcGetSystemTick() - start; }
+
+private:
+    u64 start;
+};
+
+/// Running minimum, maximum and average of a series of tick counts.
+struct Samples {
+    u64 min = ~0ULL;
+    u64 max = 0;
+    u64 total = 0;
+    u32 count = 0;
+
+    void Add(u64 ticks)
+    {
+        if (ticks < min) min = ticks;
+        if (ticks > max) max = ticks;
+        total += ticks;
+        count++;
+    }
+
+    u64 Average() const { return count ? total / count : 0; }
+};
+
+/**
+ * Returns the fastest of `runs` calls of `kernel`, in ticks. The system tick runs at the ARM11
+ * clock, so this is also the kernel's cost in cycles.
+ */
+template <typename Kernel>
+u64 BestTicks(int runs, Kernel kernel)
+{
+    Samples samples;
+    for (int i = 0; i < runs; i++) {
+        Timer timer;
+        kernel();
+        samples.Add(timer.Elapsed());
+    }
+    return samples.min;
+}
+
+/// Returns the rate at which `bytes` were processed in `ticks`, in MiB/s.
+float MiBPerSecond(u64 bytes, u64 ticks);
+
+/// Formats a duration in system ticks as microseconds, with two decimals.
+std::string FormatMicroseconds(u64 ticks);
+
+/// Formats a byte count with a KiB/MiB suffix where it divides evenly.
+std::string FormatSize(u32 bytes);
+
+/**
+ * Collects benchmark results and logs them as a table with aligned columns, to the top screen
+ * and the log file.
+ */
+class Table {
+public:
+    Table(const std::string& title, std::initializer_list<std::string> columns);
+    Table(const std::string& title, std::vector<std::string> columns);
+
+    void AddRow(std::initializer_list<std::string> cells);
+    void AddRow(std::vector<std::string> cells);
+    void Log() const;
+
+private:
+    std::string title;
+    std::vector<std::vector<std::string>> rows;
+};
+
+/// Test case name for a table row: the first label, followed by the others in parentheses.
+std::string CaseName(const std::vector<std::string>& labels);
+
+/// Average, minimum and maximum of `samples` in microseconds, as table cells.
+std::vector<std::string> LatencyCells(const Samples& samples);
+
+/**
+ * Runs `func(&result)` as a test case of `group`, then adds a row to `table` made of `labels`
+ * followed by the cells `format(result)` returns. The case is named after the labels; see
+ * CaseName. The row is added even if the case fails, so a table has a row for every case.
+ */
+template <typename Result, typename Func, typename Format>
+bool RunCase(Table* table, const std::string& group, const std::vector<std::string>& labels,
+             Func func, Format format)
+{
+    Result result = Result();
+    bool passed = Test(group, CaseName(labels), [&] { return func(&result); }, true);
+
+    std::vector<std::string> cells = labels;
+    std::vector<std::string> values = format(result);
+    cells.insert(cells.end(), values.begin(), values.end());
+    table->AddRow(cells);
+    return passed;
+}
+
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+// Reference model of the flag-setting data processing instructions, following the pseudocode
+// of the ARM Architecture Reference Manual. Kept free of 3DS headers like media_ref.h. Each
+// model updates NZCV in `cpsr` and leaves the other bits alone.
+
+#include <cstdint>
+
+#include "tests/cpu/cpsr.h"
+
+namespace CPU {
+namespace AluRef {
+
+/// Rn + Rm + carry_in, setting NZCV as ADDS/ADCS do
+inline uint32_t AddWithCarry(uint32_t rn, uint32_t rm, uint32_t carry_in, uint32_t* cpsr)
+{
+    uint64_t unsigned_sum = (uint64_t)rn + rm + carry_in;
+    int64_t signed_sum = (int64_t)(int32_t)rn + (int32_t)rm + carry_in;
+    uint32_t result = (uint32_t)unsigned_sum;
+
+    uint32_t flags = 0;
+    if (result & 0x80000000)
+        flags |= CPSR_N;
+    if (result == 0)
+        flags |= CPSR_Z;
+    if (unsigned_sum != result)
+        flags |= CPSR_C;
+    if (signed_sum != (int32_t)result)
+        flags |= CPSR_V;
+
+    *cpsr = (*cpsr & ~CPSR_NZCV_MASK) | flags;
+    return result;
+}
+
+inline uint32_t Adds(uint32_t rn, uint32_t rm, uint32_t* cpsr)
+{
+    return AddWithCarry(rn, rm, 0, cpsr);
+}
+
+inline uint32_t Adcs(uint32_t rn, uint32_t rm, uint32_t* cpsr)
+{
+    return AddWithCarry(rn, rm, (*cpsr & CPSR_C) ? 1 : 0, cpsr);
+}
+
+// Subtraction is addition of the complement, so C means "no borrow"
+
+inline uint32_t Subs(uint32_t rn, uint32_t rm, uint32_t* cpsr)
+{
+    return AddWithCarry(rn, ~rm, 1, cpsr);
+}
+
+inline uint32_t Sbcs(uint32_t rn, uint32_t rm, uint32_t* cpsr)
+{
+    return AddWithCarry(rn, ~rm, (*cpsr & CPSR_C) ? 1 : 0, cpsr);
+}
+
+} // namespace
+} // namespace
@@ -0,0 +1,747 @@
+#include <algorithm>
+#include <functional>
+#include <string>
+
+#include <3ds.h>
+
+#include "output.h"
+#include "common/string_funcs.h"
+#include "common/thread.h"
+#include "common/timer.h"
+#include "tests/benchmark.h"
+#include "tests/test.h"
+#include "tests/cpu/cputests.h"
+
+namespace CPU {
+namespace Atomics {
+
+// Operations per thread. The syscore only gets a share of its time, so cross-core runs are
+// shorter to keep them within the default budget.
+static const u32 UNCONTENDED_OPS = 1 << 20;
+static const u32 CONTENDED_OPS = 1 << 18;
+static const u32 QUEUE_ITEMS = 1 << 16;
+static const u32 MUTEX_ITEMS = 1 << 13;
+
+// Power of two, so indices wrap with a mask
+static const u32 RING_SIZE = 1024;
+
+// Cache line size of the ARM11 MPCore, used to keep the two ends of a queue apart
+#define CACHE_LINE_ALIGNED __attribute__((aligned(32)))
+
+static inline u32 LoadExclusive(volatile u32* address)
+{
+    u32 value;
+    asm volatile("ldrex %[value], [%[address]]" : [value] "=r"(value) : [address] "r"(address) : "memory");
+    return value;
+}
+
+/// Returns 0 if the store happened, 1 if the monitor had been cleared.
+static inline u32 StoreExclusive(volatile u32* address, u32 value)
+{
+    u32 failed;
+    asm volatile("strex %[failed], %[value], [%[address]]"
+                 : [failed] "=&r"(failed) : [address] "r"(address), [value] "r"(value) : "memory");
+    return failed;
+}
+
+/// Adds one to `*counter`, and returns how many times the STREX had to be retried.
+static inline u32 AtomicIncrement(volatile u32* counter)
+{
+    u32 value, failed, retries = 0;
+    asm volatile("1: ldrex %[value], [%[counter]]\n"
+                 "   add %[value], %[value], #1\n"
+                 "   strex %[failed], %[value], [%[counter]]\n"
+                 "   teq %[failed], #0\n"
+                 "   addne %[retries], %[retries], #1\n"
+                 "   bne 1b\n"
+                 : [value] "=&r"(value), [failed] "=&r"(failed), [retries] "+r"(retries)
+                 : [counter] "r"(counter)
+                 : "cc", "memory");
+    return retries;
+}
+
+/// Stores `desired` if `*address` holds `expected`, and returns the value it held.
+static inline u32 CompareAndSwap(volatile u32* address, u32 expected, u32 desired)
+{
+    u32 found, failed;
+    asm volatile("1: ldrex %[found], [%[address]]\n"
+                 "   mov %[failed], #0\n"
+                 "   teq %[found], %[expected]\n"
+                 "   strexeq %[failed], %[desired], [%[address]]\n"
+                 "   teq %[failed], #0\n"
+                 "   bne 1b\n"
+                 : [found] "=&r"(found), [failed] "=&r"(failed)
+                 : [address] "r"(address), [expected] "r"(expected), [desired] "r"(desired)
+                 : "cc", "memory");
+    return found;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Monitor semantics
+
+static u32 word_target;
+static u8 byte_target[4];
+static u16 halfword_target[2];
+static u64 doubleword_target __attribute__((aligned(8)));
+
+static bool TestStorePair()
+{
+    word_target = 0x11111111;
+    u32 loaded, failed;
+    asm volatile("ldrex %[loaded], [%[address]]\n"
+                 "strex %[failed], %[value], [%[address]]\n"
+                 : [loaded] "=&r"(loaded), [failed] "=&r"(failed)
+                 : [address] "r"(&word_target), [value] "r"(0x22222222)
+                 : "memory");
+    SoftAssert(loaded == 0x11111111);
+    SoftAssert(failed == 0);
+    SoftAssert(word_target == 0x22222222);
+    return true;
+}
+
+static bool TestStoreWithoutLoad()
+{
+    word_target = 0x11111111;
+    u32 failed;
+    asm volatile("clrex\n"
+                 "strex %[failed], %[value], [%[address]]\n"
+                 : [failed] "=&r"(failed)
+                 : [address] "r"(&word_target), [value] "r"(0x22222222)
+                 : "memory");
+    SoftAssert(failed == 1);
+    SoftAssert(word_target == 0x11111111);
+    return true;
+}
+
+static bool TestClearBetween()
+{
+    word_target = 0x11111111;
+    u32 loaded, failed;
+    asm volatile("ldrex %[loaded], [%[address]]\n"
+                 "clrex\n"
+                 "strex %[failed], %[value], [%[address]]\n"
+                 : [loaded] "=&r"(loaded), [failed] "=&r"(failed)
+                 : [address] "r"(&word_target), [value] "r"(0x22222222)
+                 : "memory");
+    SoftAssert(failed == 1);
+    SoftAssert(word_target == 0x11111111);
+    return true;
+}
+
+// A successful STREX consumes the reservation, so a second one without a new LDREX fails
+static bool TestSecondStore()
+{
+    word_target = 0x11111111;
+    u32 loaded, first, second;
+    asm volatile("ldrex %[loaded], [%[address]]\n"
+                 "strex %[first], %[value], [%[address]]\n"
+                 "strex %[second], %[loaded], [%[address]]\n"
+                 : [loaded] "=&r"(loaded), [first] "=&r"(first), [second] "=&r"(second)
+                 : [address] "r"(&word_target), [value] "r"(0x22222222)
+                 : "memory");
+    SoftAssert(first == 0);
+    SoftAssert(second == 1);
+    SoftAssert(word_target == 0x22222222);
+    return true;
+}
+
+static bool TestByte()
+{
+    byte_target[0] = 0x11; byte_target[1] = 0x22; byte_target[2] = 0x33; byte_target[3] = 0x44;
+    u32 loaded, failed;
+    asm volatile("ldrexb %[loaded], [%[address]]\n"
+                 "strexb %[failed], %[value], [%[address]]\n"
+                 : [loaded] "=&r"(loaded), [failed] "=&r"(failed)
+                 : [address] "r"(&byte_target[2]), [value] "r"(0xAB)
+                 : "memory");
+    SoftAssert(loaded == 0x33);
+    SoftAssert(failed == 0);
+    SoftAssert(byte_target[0] == 0x11 && byte_target[1] == 0x22);
+    SoftAssert(byte_target[2] == 0xAB && byte_target[3] == 0x44);
+    return true;
+}
+
+static bool TestHalfword()
+{
+    halfword_target[0] = 0x1111; halfword_target[1] = 0x2222;
+    u32 loaded, failed;
+    asm volatile("ldrexh %[loaded], [%[address]]\n"
+                 "strexh %[failed], %[value], [%[address]]\n"
+                 : [loaded] "=&r"(loaded), [failed] "=&r"(failed)
+                 : [address] "r"(&halfword_target[1]), [value] "r"(0xABCD)
+                 : "memory");
+    SoftAssert(loaded == 0x2222);
+    SoftAssert(failed == 0);
+    SoftAssert(halfword_target[0] == 0x1111 && halfword_target[1] == 0xABCD);
+    return true;
+}
+
+static bool TestDoubleword()
+{
+    doubleword_target = 0x1111111122222222ULL;
+    u64 loaded;
+    u64 value = 0x3333333344444444ULL;
+    u32 failed;
+    asm volatile("ldrexd %[loaded], %H[loaded], [%[address]]\n"
+                 "strexd %[failed], %[value], %H[value], [%[address]]\n"
+                 : [loaded] "=&r"(loaded), [failed] "=&r"(failed)
+                 : [address] "r"(&doubleword_target), [value] "r"(value)
+                 : "memory");
+    SoftAssert(loaded == 0x1111111122222222ULL);
+    SoftAssert(failed == 0);
+    SoftAssert(doubleword_target == value);
+    return true;
+}
+
+// Whether a plain store or an SVC between LDREX and STREX clears the monitor is left to the
+// implementation, so these are logged rather than tested
+static u32 PlainStoreBetween()
+{
+    word_target = 0x11111111;
+    u32 loaded, failed;
+    asm volatile("ldrex %[loaded], [%[address]]\n"
+                 "str %[loaded], [%[address]]\n"
+                 "strex %[failed], %[value], [%[address]]\n"
+                 : [loaded] "=&r"(loaded), [failed] "=&r"(failed)
+                 : [address] "r"(&word_target), [value] "r"(0x22222222)
+                 : "memory");
+    return failed;
+}
+
+static u32 SvcBetween()
+{
+    word_target = 0x11111111;
+    LoadExclusive(&word_target);
+    svcGetSystemTick();
+    return StoreExclusive(&word_target, 0x22222222);
+}
+
+struct CrossCoreStore {
+    volatile u32 target;
+    volatile u32 request;
+    volatile u32 done;
+};
+
+static void CrossCoreStoreThread(void* arg)
+{
+    CrossCoreStore* state = static_cast<CrossCoreStore*>(arg);
+    while (!state->request) {}
+    state->target = 0x33333333;
+    __sync_synchronize();
+    state->done = 1;
+}
+
+// A store from the other core between LDREX and STREX must make the STREX fail, or its update
+// would be lost
+static bool TestCrossCoreStore()
+{
+    CrossCoreStore state = { 0x11111111, 0, 0 };
+    Common::Thread thread(CrossCoreStoreThread, &state, Common::GetCurrentThreadPriority(), Common::CORE_SYS);
+    SoftAssert(thread.IsValid());
+
+    LoadExclusive(&state.target);
+    state.request = 1;
+    while (!state.done) {}
+    u32 failed = StoreExclusive(&state.target, 0x22222222);
+
+    thread.Join();
+    SoftAssert(failed == 1);
+    SoftAssert(state.target == 0x33333333);
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Queues
+
+/// Single-producer single-consumer ring: each index is only written by one side.
+struct SpscQueue {
+    volatile u32 head CACHE_LINE_ALIGNED;
+    volatile u32 tail CACHE_LINE_ALIGNED;
+    u32 slots[RING_SIZE] CACHE_LINE_ALIGNED;
+
+    void Reset() { head = tail = 0; }
+
+    bool Push(u32 value)
+    {
+        u32 position = tail;
+        if (position - head == RING_SIZE)
+            return false;
+        slots[position & (RING_SIZE - 1)] = value;
+        __sync_synchronize();
+        tail = position + 1;
+        return true;
+    }
+
+    bool Pop(u32* value)
+    {
+        u32 position = head;
+        if (position == tail)
+            return false;
+        __sync_synchronize();
+        *value = slots[position & (RING_SIZE - 1)];
+        __sync_synchronize();
+        head = position + 1;
+        return true;
+    }
+};
+
+/**
+ * Bounded multi-producer multi-consumer ring after Dmitry Vyukov's design. Each cell carries a
+ * sequence number telling whether it is ready to be written or read at a given position, so
+ * producers and consumers only contend on a compare-and-swap of their own end.
+ */
+struct MpmcQueue {
+    struct Cell {
+        volatile u32 sequence;
+        u32 value;
+    };
+
+    volatile u32 enqueue_position CACHE_LINE_ALIGNED;
+    volatile u32 dequeue_position CACHE_LINE_ALIGNED;
+    Cell cells[RING_SIZE] CACHE_LINE_ALIGNED;
+
+    void Reset()
+    {
+        enqueue_position = dequeue_position = 0;
+        for (u32 i = 0; i < RING_SIZE; i++)
+            cells[i].sequence = i;
+    }
+
+    /// Returns false if the queue is full. Failed compare-and-swaps are added to `retries`.
+    bool Push(u32 value, u32* retries)
+    {
+        u32 position = enqueue_position;
+        Cell* cell;
+        for (;;) {
+            cell = &cells[position & (RING_SIZE - 1)];
+            s32 difference = (s32)(cell->sequence - position);
+            if (difference == 0) {
+                u32 found = CompareAndSwap(&enqueue_position, position, position + 1);
+                if (found == position)
+                    break;
+                position = found;
+                (*retries)++;
+            } else if (difference < 0) {
+                return false;
+            } else {
+                position = enqueue_position;
+            }
+        }
+        __sync_synchronize();
+        cell->value = value;
+        __sync_synchronize();
+        cell->sequence = position + 1;
+        return true;
+    }
+
+    /// Returns false if the queue is empty. Failed compare-and-swaps are added to `retries`.
+    bool Pop(u32* value, u32* retries)
+    {
+        u32 position = dequeue_position;
+        Cell* cell;
+        for (;;) {
+            cell = &cells[position & (RING_SIZE - 1)];
+            s32 difference = (s32)(cell->sequence - (position + 1));
+            if (difference == 0) {
+                u32 found = CompareAndSwap(&dequeue_position, position, position + 1);
+                if (found == position)
+                    break;
+                position = found;
+                (*retries)++;
+            } else if (difference < 0) {
+                return false;
+            } else {
+                position = dequeue_position;
+            }
+        }
+        __sync_synchronize();
+        *value = cell->value;
+        __sync_synchronize();
+        cell->sequence = position + RING_SIZE;
+        return true;
+    }
+};
+
+/// Plain ring for the lock-based queues; callers hold the lock
+struct Ring {
+    u32 head;
+    u32 tail;
+    u32 slots[RING_SIZE];
+
+    void Reset() { head = tail = 0; }
+
+    bool Push(u32 value)
+    {
+        if (tail - head == RING_SIZE)
+            return false;
+        slots[tail++ & (RING_SIZE - 1)] = value;
+        return true;
+    }
+
+    bool Pop(u32* value)
+    {
+        if (head == tail)
+            return false;
+        *value = slots[head++ & (RING_SIZE - 1)];
+        return true;
+    }
+};
+
+/// User-mode lock on LDREX/STREX alone: the uncontended path of a light lock, without the sleep.
+struct SpinLock {
+    volatile u32 locked;
+
+    void Lock()
+    {
+        while (LoadExclusive(&locked) != 0 || StoreExclusive(&locked, 1) != 0) {}
+        __sync_synchronize();
+    }
+
+    void Unlock()
+    {
+        __sync_synchronize();
+        locked = 0;
+    }
+};
+
+/// Ring guarded by a kernel mutex
+struct MutexQueue {
+    Common::Mutex mutex;
+    Ring ring;
+
+    bool Push(u32 value)
+    {
+        Common::LockGuard lock(mutex);
+        return ring.Push(value);
+    }
+
+    bool Pop(u32* value)
+    {
+        Common::LockGuard lock(mutex);
+        return ring.Pop(value);
+    }
+};
+
+struct SpinLockQueue {
+    SpinLock spin_lock;
+    Ring ring;
+
+    bool Push(u32 value)
+    {
+        spin_lock.Lock();
+        bool pushed = ring.Push(value);
+        spin_lock.Unlock();
+        return pushed;
+    }
+
+    bool Pop(u32* value)
+    {
+        spin_lock.Lock();
+        bool popped = ring.Pop(value);
+        spin_lock.Unlock();
+        return popped;
+    }
+};
+
+static SpscQueue spsc_queue;
+static MpmcQueue mpmc_queue;
+static MutexQueue mutex_queue;
+static SpinLockQueue spin_lock_queue;
+
+////////////////////////////////////////////////////////////////////////////////
+// Benchmarks
+
+struct Throughput {
+    u64 operations;
+    u64 ticks;
+    u32 retries;
+};
+
+namespace {
+
+struct StartLine {
+    volatile u32 ready;     ///< Threads waiting to start
+    volatile u32 aborted;   ///< Set if a thread could not be created, so the other one gives up
+};
+
+struct CoreRun {
+    const std::function<bool(u32, u32*)>* body;
+    StartLine* start_line;
+    u32 index;
+    u32 retries;
+    bool passed;
+    u64 started;
+    u64 finished;
+};
+
+}
+
+static void CoreRunEntry(void* arg)
+{
+    CoreRun* run = static_cast<CoreRun*>(arg);
+
+    // Both threads start together, whichever core gets going first
+    AtomicIncrement(&run->start_line->ready);
+    while (run->start_line->ready != 2) {
+        if (run->start_line->aborted)
+            return;
+    }
+
+    run->started = svcGetSystemTick();
+    run->passed = (*run->body)(run->index, &run->retries);
+    run->finished = svcGetSystemTick();
+}
+
+/**
+ * Runs `body(index, &retries)` at once on a thread on the app core (index 0) and one on the
+ * syscore (index 1), and measures the time from the later start to the later finish. Returns
+ * whether both threads started and both bodies returned true.
+ */
+static bool RunOnBothCores(const std::function<bool(u32, u32*)>& body, u64 operations, Throughput* result)
+{
+    StartLine start_line = { 0, 0 };
+    CoreRun runs[2] = {
+        { &body, &start_line, 0, 0, false, 0, 0 },
+        { &body, &start_line, 1, 0, false, 0, 0 },
+    };
+
+    {
+        s32 priority = Common::GetCurrentThreadPriority();
+        Common::Thread app(CoreRunEntry, &runs[0], priority, Common::CORE_APP);
+        Common::Thread sys(CoreRunEntry, &runs[1], priority, Common::CORE_SYS);
+        if (!app.IsValid() || !sys.IsValid()) {
+            start_line.aborted = 1;
+            return false;
+        }
+    }
+
+    u64 started = std::max(runs[0].started, runs[1].started);
+    u64 finished = std::max(runs[0].finished, runs[1].finished);
+    *result = { operations, finished - started, runs[0].retries + runs[1].retries };
+    return runs[0].passed && runs[1].passed;
+}
+
+static bool RunOnThisCore(const std::function<bool(u32, u32*)>& body, u64 operations, Throughput* result)
+{
+    u32 retries = 0;
+    Benchmark::Timer timer;
+    bool passed = body(0, &retries);
+    *result = { operations, timer.Elapsed(), retries };
+    return passed;
+}
+
+static volatile u32 shared_counter CACHE_LINE_ALIGNED;
+
+static bool IncrementBody(u32 count, u32* retries)
+{
+    for (u32 i = 0; i < count; i++)
+        *retries += AtomicIncrement(&shared_counter);
+    return true;
+}
+
+static bool CompareAndSwapBody(u32 count, u32* retries)
+{
+    for (u32 i = 0; i < count; i++) {
+        u32 expected = shared_counter;
+        for (;;) {
+            u32 found = CompareAndSwap(&shared_counter, expected, expected + 1);
+            if (found == expected)
+                break;
+            expected = found;
+            (*retries)++;
+        }
+    }
+    return true;
+}
+
+// Producer on index 0 and consumer on index 1, which checks the values arrive in order
+template <typename Queue>
+static bool ProducerConsumerBody(Queue* queue, u32 index, u32 count)
+{
+    if (index == 0) {
+        for (u32 i = 0; i < count; i++) {
+            while (!queue->Push(i)) {}
+        }
+        return true;
+    }
+
+    for (u32 i = 0; i < count; i++) {
+        u32 value;
+        while (!queue->Pop(&value)) {}
+        if (value != i)
+            return false;
+    }
+    return true;
+}
+
+// Single thread alternating pushes and pops, so the queue never fills or empties
+template <typename Queue>
+static bool PushPopBody(Queue* queue, u32 count)
+{
+    for (u32 i = 0; i < count; i++) {
+        u32 value;
+        if (!queue->Push(i) || !queue->Pop(&value) || value != i)
+            return false;
+    }
+    return true;
+}
+
+// Items of the MPMC runs carry the producing thread in their top bit
+static u32 MpmcItem(u32 index, u32 i)
+{
+    return (index << 31) | i;
+}
+
+static u32 MpmcChecksum(u32 count)
+{
+    u32 checksum = 0;
+    for (u32 index = 0; index < 2; index++) {
+        for (u32 i = 0; i < count; i++)
+            checksum += MpmcItem(index, i);
+    }
+    return checksum;
+}
+
+static volatile u32 mpmc_popped[2];
+static volatile u32 mpmc_checksums[2];
+
+// Both threads push their own items and pop whatever is there, until every item is popped
+static bool MpmcBody(u32 index, u32 count, u32* retries)
+{
+    u32 pushed = 0;
+    u32 popped = 0;
+    u32 checksum = 0;
+    while (pushed < count || mpmc_popped[0] + mpmc_popped[1] < 2 * count) {
+        if (pushed < count && mpmc_queue.Push(MpmcItem(index, pushed), retries))
+            pushed++;
+
+        u32 value;
+        if (mpmc_queue.Pop(&value, retries)) {
+            checksum += value;
+            mpmc_popped[index] = ++popped;
+        }
+    }
+    mpmc_checksums[index] = checksum;
+    return true;
+}
+
+static std::string FormatKops(const Throughput& result)
+{
+    if (result.ticks == 0)
+        return "-";
+    u64 kops = result.operations * Common::TICKS_PER_SECOND / result.ticks / 1000;
+    return Common::FormatString("%llu", kops);
+}
+
+static std::string FormatNanoseconds(const Throughput& result)
+{
+    if (result.operations == 0)
+        return "-";
+    u64 nanoseconds = result.ticks * 1000000000ULL / Common::TICKS_PER_SECOND / result.operations;
+    return Common::FormatString("%llu", nanoseconds);
+}
+
+void TestAll()
+{
+    const std::string tag = "Atomics";
+
+    Test(tag, "LDREX/STREX pair", TestStorePair, true);
+    Test(tag, "STREX without LDREX fails", TestStoreWithoutLoad, true);
+    Test(tag, "CLREX clears the monitor", TestClearBetween, true);
+    Test(tag, "STREX clears the monitor", TestSecondStore, true);
+    Test(tag, "LDREXB/STREXB", TestByte, true);
+    Test(tag, "LDREXH/STREXH", TestHalfword, true);
+    Test(tag, "LDREXD/STREXD", TestDoubleword, true);
+
+    Log(GFX_TOP, Common::FormatString("Plain STR between LDREX/STREX: STREX %s\n",
+                                      PlainStoreBetween() ? "fails" : "succeeds"));
+    Log(GFX_TOP, Common::FormatString("SVC between LDREX/STREX: STREX %s\n",
+                                      SvcBetween() ? "fails" : "succeeds"));
+
+    Common::ReserveSysCoreTime();
+    Test(tag, "STREX fails after a store from the other core", TestCrossCoreStore, true);
+
+    Benchmark::Table table(Common::FormatString("Exclusive access throughput (syscore at %u%%)",
+                                                (unsigned)Common::SYSCORE_TIME_PERCENT),
+                           { "Operation", "Cores", "Kops/s", "ns/op", "Retries" });
+    auto bench = [&](const std::string& name, bool both_cores, u64 operations, bool show_retries,
+                     std::function<bool(u32, u32*)> body, std::function<bool()> check) {
+        auto run = [&](Throughput* result) {
+            bool passed = both_cores ? RunOnBothCores(body, operations, result)
+                                     : RunOnThisCore(body, operations, result);
+            return passed && check();
+        };
+        auto cells = [&](const Throughput& result) -> std::vector<std::string> {
+            return { FormatKops(result), FormatNanoseconds(result),
+                     show_retries ? Common::FormatString("%u", (unsigned)result.retries) : "-" };
+        };
+        Benchmark::RunCase<Throughput>(&table, tag, { name, both_cores ? "app+sys" : "app" }, run, cells);
+    };
+
+    auto counter_is = [](u32 expected) { return [expected] { return shared_counter == expected; }; };
+    auto reset_counter = [] { shared_counter = 0; };
+
+    reset_counter();
+    bench("Atomic increment", false, UNCONTENDED_OPS, true,
+          [](u32, u32* retries) { return IncrementBody(UNCONTENDED_OPS, retries); },
+          counter_is(UNCONTENDED_OPS));
+    reset_counter();
+    bench("Atomic increment", true, 2 * CONTENDED_OPS, true,
+          [](u32, u32* retries) { return IncrementBody(CONTENDED_OPS, retries); },
+          counter_is(2 * CONTENDED_OPS));
+    reset_counter();
+    bench("CAS loop increment", false, UNCONTENDED_OPS, true,
+          [](u32, u32* retries) { return CompareAndSwapBody(UNCONTENDED_OPS, retries); },
+          counter_is(UNCONTENDED_OPS));
+    reset_counter();
+    bench("CAS loop increment", true, 2 * CONTENDED_OPS, true,
+          [](u32, u32* retries) { return CompareAndSwapBody(CONTENDED_OPS, retries); },
+          counter_is(2 * CONTENDED_OPS));
+
+    auto always = [] { return true; };
+
+    // Queue operations count both the push and the pop of each item
+    spsc_queue.Reset();
+    bench("SPSC ring", false, 2 * QUEUE_ITEMS, false,
+          [](u32, u32*) { return PushPopBody(&spsc_queue, QUEUE_ITEMS); }, always);
+    spsc_queue.Reset();
+    bench("SPSC ring", true, 2 * QUEUE_ITEMS, false,
+          [](u32 index, u32*) { return ProducerConsumerBody(&spsc_queue, index, QUEUE_ITEMS); }, always);
+
+    auto mpmc_matches = [] {
+        return mpmc_popped[0] + mpmc_popped[1] == 2 * QUEUE_ITEMS &&
+               mpmc_checksums[0] + mpmc_checksums[1] == MpmcChecksum(QUEUE_ITEMS);
+    };
+    mpmc_queue.Reset();
+    bench("MPMC ring", false, 2 * QUEUE_ITEMS, true, [](u32, u32* retries) {
+        for (u32 i = 0; i < QUEUE_ITEMS; i++) {
+            u32 value;
+            if (!mpmc_queue.Push(i, retries) || !mpmc_queue.Pop(&value, retries) || value != i)
+                return false;
+        }
+        return true;
+    }, always);
+    mpmc_queue.Reset();
+    mpmc_popped[0] = mpmc_popped[1] = 0;
+    bench("MPMC ring", true, 4 * QUEUE_ITEMS, true,
+          [](u32 index, u32* retries) { return MpmcBody(index, QUEUE_ITEMS, retries); }, mpmc_matches);
+
+    spin_lock_queue.ring.Reset();
+    bench("Spinlock ring", false, 2 * QUEUE_ITEMS, false,
+          [](u32, u32*) { return PushPopBody(&spin_lock_queue, QUEUE_ITEMS); }, always);
+    spin_lock_queue.ring.Reset();
+    bench("Spinlock ring", true, 2 * QUEUE_ITEMS, false,
+          [](u32 index, u32*) { return ProducerConsumerBody(&spin_lock_queue, index, QUEUE_ITEMS); }, always);
+
+    mutex_queue.ring.Reset();
+    bench("Kernel mutex ring", false, 2 * MUTEX_ITEMS, false,
+          [](u32, u32*) { return PushPopBody(&mutex_queue, MUTEX_ITEMS); }, always);
+    mutex_queue.ring.Reset();
+    bench("Kernel mutex ring", true, 2 * MUTEX_ITEMS, false,
+          [](u32 index, u32*) { return ProducerConsumerBody(&mutex_queue, index, MUTEX_ITEMS); }, always);
+
+    table.Log();
+}
+
+} // namespace
+} // namespace
@@ -0,0 +1,321 @@
+#include <string>
+
+#include <3ds.h>
+
+#include "output.h"
+#include "common/random.h"
+#include "common/string_funcs.h"
+#include "tests/benchmark.h"
+#include "tests/test.h"
+#include "tests/cpu/cputests.h"
+
+namespace CPU {
+namespace Branch {
+
+// Length of the branch and dispatch patterns. Small enough to stay in the data cache, long
+// enough that random patterns cannot be learnt.
+static const u32 PATTERN_LENGTH = 4096;
+static const u32 CALL_ITERATIONS = 1024;
+static const u32 BLOCK_ITERATIONS = 16;
+static const int KERNEL_RUNS = 16;
+
+static const u32 NUM_HANDLERS = 8;
+
+static u8 pattern[PATTERN_LENGTH];
+
+////////////////////////////////////////////////////////////////////////////////
+// Kernels. Each returns a value computed from its input, so the tests can check it ran the way
+// it was meant to.
+
+/// Loops over `count` pattern bytes, branching over an add for each zero byte.
+static u32 ConditionalBranches(const u8* bytes, u32 count)
+{
+    u32 value, sum = 0;
+    asm volatile("1: ldrb %[value], [%[bytes]], #1\n"
+                 "   cmp %[value], #0\n"
+                 "   beq 2f\n"
+                 "   add %[sum], %[sum], #1\n"
+                 "2: subs %[count], %[count], #1\n"
+                 "   bne 1b\n"
+                 : [value] "=&r"(value), [sum] "+r"(sum), [bytes] "+r"(bytes), [count] "+r"(count)
+                 :
+                 : "cc", "memory");
+    return sum;
+}
+
+/// The same loop with a conditional add instead of the branch, as the baseline.
+static u32 ConditionalExecution(const u8* bytes, u32 count)
+{
+    u32 value, sum = 0;
+    asm volatile("1: ldrb %[value], [%[bytes]], #1\n"
+                 "   cmp %[value], #0\n"
+                 "   addne %[sum], %[sum], #1\n"
+                 "   subs %[count], %[count], #1\n"
+                 "   bne 1b\n"
+                 : [value] "=&r"(value), [sum] "+r"(sum), [bytes] "+r"(bytes), [count] "+r"(count)
+                 :
+                 : "cc", "memory");
+    return sum;
+}
+
+// Handler n adds n + 1, so the sum tells whether every opcode reached its own handler
+#define JUMP_TABLE \
+    "3: .word 10f, 11f, 12f, 13f, 14f, 15f, 16f, 17f\n"
+
+/// Interpreter-style loop: every handler branches back to a single dispatch point.
+static u32 CentralDispatch(const u8* program, u32 count)
+{
+    u32 opcode, table, sum = 0;
+    asm volatile("   adr %[table], 3f\n"
+                 "   b 1f\n"
+                 JUMP_TABLE
+                 "1: ldrb %[opcode], [%[program]], #1\n"
+                 "   ldr pc, [%[table], %[opcode], lsl #2]\n"
+                 "10: add %[sum], %[sum], #1\n"
+                 "   b 2f\n"
+                 "11: add %[sum], %[sum], #2\n"
+                 "   b 2f\n"
+                 "12: add %[sum], %[sum], #3\n"
+                 "   b 2f\n"
+                 "13: add %[sum], %[sum], #4\n"
+                 "   b 2f\n"
+                 "14: add %[sum], %[sum], #5\n"
+                 "   b 2f\n"
+                 "15: add %[sum], %[sum], #6\n"
+                 "   b 2f\n"
+                 "16: add %[sum], %[sum], #7\n"
+                 "   b 2f\n"
+                 "17: add %[sum], %[sum], #8\n"
+                 "2: subs %[count], %[count], #1\n"
+                 "   bne 1b\n"
+                 : [opcode] "=&r"(opcode), [table] "=&r"(table), [sum] "+r"(sum),
+                   [program] "+r"(program), [count] "+r"(count)
+                 :
+                 : "cc", "memory");
+    return sum;
+}
+
+#define THREADED_HANDLER(label, amount) \
+    label ": add %[sum], %[sum], #" amount "\n" \
+    "   subs %[count], %[count], #1\n" \
+    "   ldrneb %[opcode], [%[program]], #1\n" \
+    "   ldrne pc, [%[table], %[opcode], lsl #2]\n" \
+    "   b 2f\n"
+
+/// Threaded dispatch: every handler fetches and jumps to the next one itself.
+static u32 ThreadedDispatch(const u8* program, u32 count)
+{
+    u32 opcode, table, sum = 0;
+    asm volatile("   adr %[table], 3f\n"
+                 "   ldrb %[opcode], [%[program]], #1\n"
+                 "   ldr pc, [%[table], %[opcode], lsl #2]\n"
+                 JUMP_TABLE
+                 THREADED_HANDLER("10", "1")
+                 THREADED_HANDLER("11", "2")
+                 THREADED_HANDLER("12", "3")
+                 THREADED_HANDLER("13", "4")
+                 THREADED_HANDLER("14", "5")
+                 THREADED_HANDLER("15", "6")
+                 THREADED_HANDLER("16", "7")
+                 THREADED_HANDLER("17", "8")
+                 "2:\n"
+                 : [opcode] "=&r"(opcode), [table] "=&r"(table), [sum] "+r"(sum),
+                   [program] "+r"(program), [count] "+r"(count)
+                 :
+                 : "cc", "memory");
+    return sum;
+}
+
+#undef THREADED_HANDLER
+#undef JUMP_TABLE
+
+/**
+ * Makes `count` chains of `depth` nested calls, each returning with a POP of the PC as compiled
+ * code does. Chains deeper than the return stack mispredict their outer returns. Returns the
+ * number of calls made.
+ */
+static u32 CallChains(u32 depth, u32 count)
+{
+    u32 level, calls = 0;
+    asm volatile("1: mov %[level], %[depth]\n"
+                 "   bl 10f\n"
+                 "   subs %[count], %[count], #1\n"
+                 "   bne 1b\n"
+                 "   b 20f\n"
+                 "10: push {lr}\n"
+                 "   add %[calls], %[calls], #1\n"
+                 "   subs %[level], %[level], #1\n"
+                 "   blne 10b\n"
+                 "   pop {pc}\n"
+                 "20:\n"
+                 : [level] "=&r"(level), [calls] "+r"(calls), [count] "+r"(count)
+                 : [depth] "r"(depth)
+                 : "lr", "cc", "memory");
+    return calls;
+}
+
+/**
+ * Straight-line blocks of `kib` KiB of independent adds, run `count` times in a loop, to find
+ * where the code stops fitting the instruction cache. Returns the number of adds executed.
+ */
+#define CODE_BLOCK(name, kib) \
+    static u32 name(u32 count) \
+    { \
+        u32 a = 0, b = 0, c = 0, d = 0; \
+        asm volatile("1:\n" \
+                     ".rept " #kib " * 64\n" \
+                     "   add %[a], %[a], #1\n" \
+                     "   add %[b], %[b], #1\n" \
+                     "   add %[c], %[c], #1\n" \
+                     "   add %[d], %[d], #1\n" \
+                     ".endr\n" \
+                     "   subs %[count], %[count], #1\n" \
+                     "   bne 1b\n" \
+                     : [a] "+r"(a), [b] "+r"(b), [c] "+r"(c), [d] "+r"(d), [count] "+r"(count) \
+                     : \
+                     : "cc"); \
+        return a + b + c + d; \
+    }
+
+CODE_BLOCK(CodeBlock1K, 1)
+CODE_BLOCK(CodeBlock2K, 2)
+CODE_BLOCK(CodeBlock4K, 4)
+CODE_BLOCK(CodeBlock8K, 8)
+CODE_BLOCK(CodeBlock16K, 16)
+CODE_BLOCK(CodeBlock32K, 32)
+CODE_BLOCK(CodeBlock64K, 64)
+
+#undef CODE_BLOCK
+
+/// Adds per KiB of straight-line code
+static const u32 ADDS_PER_KIB = 256;
+
+////////////////////////////////////////////////////////////////////////////////
+
+enum PatternKind {
+    PATTERN_NEVER_TAKEN,
+    PATTERN_ALWAYS_TAKEN,
+    PATTERN_ALTERNATING,
+    PATTERN_ONE_IN_8,   ///< Taken every eighth time, like the exit of a short loop
+    PATTERN_CYCLE,      ///< Every value below the range in turn
+    PATTERN_RANDOM,
+};
+
+/// Fills `pattern` with values below `range`. For branches, 0 means the branch is taken.
+static void FillPattern(PatternKind kind, u32 range)
+{
+    Common::XorShift32 rng(0x0B5A7C4D);
+    for (u32 i = 0; i < PATTERN_LENGTH; i++) {
+        switch (kind) {
+            case PATTERN_NEVER_TAKEN:  pattern[i] = 1 % range; break;
+            case PATTERN_ALWAYS_TAKEN: pattern[i] = 0; break;
+            case PATTERN_ALTERNATING:  pattern[i] = i % 2; break;
+            case PATTERN_ONE_IN_8:     pattern[i] = (i % 8 == 7) ? 0 : 1 % range; break;
+            case PATTERN_CYCLE:        pattern[i] = i % range; break;
+            case PATTERN_RANDOM:       pattern[i] = rng.Next() % range; break;
+        }
+    }
+}
+
+static u32 ExpectedSum(u32 (*weight)(u8))
+{
+    u32 sum = 0;
+    for (u32 i = 0; i < PATTERN_LENGTH; i++)
+        sum += weight(pattern[i]);
+    return sum;
+}
+
+/// Cycles per iteration, to a tenth of a cycle
+static std::string CyclesPer(u64 ticks, u32 iterations)
+{
+    u64 tenths = ticks * 10 / iterations;
+    return Common::FormatString("%llu.%llu", tenths / 10, tenths % 10);
+}
+
+void TestAll()
+{
+    const std::string tag = "Branch";
+
+    Benchmark::Table table("Branch and code layout cost (cycles per iteration)",
+                           { "Kernel", "Pattern", "Cycles" });
+
+    struct {
+        const char* name;
+        PatternKind kind;
+    } const branch_patterns[] = {
+        { "never taken",  PATTERN_NEVER_TAKEN },
+        { "always taken", PATTERN_ALWAYS_TAKEN },
+        { "alternating",  PATTERN_ALTERNATING },
+        { "taken 1 in 8", PATTERN_ONE_IN_8 },
+        { "random",       PATTERN_RANDOM },
+    };
+    for (const auto& branch_pattern : branch_patterns) {
+        FillPattern(branch_pattern.kind, 2);
+        u32 expected = ExpectedSum([](u8 value) -> u32 { return value != 0; });
+        Test(tag, Common::FormatString("Conditional branch, %s", branch_pattern.name), [&] {
+            return ConditionalBranches(pattern, PATTERN_LENGTH) == expected &&
+                   ConditionalExecution(pattern, PATTERN_LENGTH) == expected;
+        }, true);
+
+        table.AddRow({ "Conditional branch", branch_pattern.name,
+                       CyclesPer(Benchmark::BestTicks(KERNEL_RUNS, [] { ConditionalBranches(pattern, PATTERN_LENGTH); }), PATTERN_LENGTH) });
+        table.AddRow({ "Conditional add", branch_pattern.name,
+                       CyclesPer(Benchmark::BestTicks(KERNEL_RUNS, [] { ConditionalExecution(pattern, PATTERN_LENGTH); }), PATTERN_LENGTH) });
+    }
+
+    struct {
+        const char* name;
+        PatternKind kind;
+    } const dispatch_patterns[] = {
+        { "same handler", PATTERN_NEVER_TAKEN },
+        { "cycle of 8",   PATTERN_CYCLE },
+        { "random of 8",  PATTERN_RANDOM },
+    };
+    for (const auto& dispatch_pattern : dispatch_patterns) {
+        FillPattern(dispatch_pattern.kind, NUM_HANDLERS);
+        u32 expected = ExpectedSum([](u8 value) -> u32 { return value + 1; });
+        Test(tag, Common::FormatString("Jump table dispatch, %s", dispatch_pattern.name), [&] {
+            return CentralDispatch(pattern, PATTERN_LENGTH) == expected &&
+                   ThreadedDispatch(pattern, PATTERN_LENGTH) == expected;
+        }, true);
+
+        table.AddRow({ "Central dispatch", dispatch_pattern.name,
+                       CyclesPer(Benchmark::BestTicks(KERNEL_RUNS, [] { CentralDispatch(pattern, PATTERN_LENGTH); }), PATTERN_LENGTH) });
+        table.AddRow({ "Threaded dispatch", dispatch_pattern.name,
+                       CyclesPer(Benchmark::BestTicks(KERNEL_RUNS, [] { ThreadedDispatch(pattern, PATTERN_LENGTH); }), PATTERN_LENGTH) });
+    }
+
+    // One iteration is a call and its return
+    for (u32 depth : { 1, 2, 3, 4, 5, 8, 16 }) {
+        Test(tag, Common::FormatString("Call chain, depth %u", (unsigned)depth),
+             [&] { return CallChains(depth, CALL_ITERATIONS); }, depth * CALL_ITERATIONS);
+        table.AddRow({ "Call/return", Common::FormatString("depth %u", (unsigned)depth),
+                       CyclesPer(Benchmark::BestTicks(KERNEL_RUNS, [&] { CallChains(depth, CALL_ITERATIONS); }),
+                                 depth * CALL_ITERATIONS) });
+    }
+
+    // One iteration is a pass over the whole block
+    struct {
+        u32 kib;
+        u32 (*kernel)(u32);
+    } const blocks[] = {
+        { 1, CodeBlock1K }, { 2, CodeBlock2K }, { 4, CodeBlock4K }, { 8, CodeBlock8K },
+        { 16, CodeBlock16K }, { 32, CodeBlock32K }, { 64, CodeBlock64K },
+    };
+    for (const auto& block : blocks) {
+        u32 adds = block.kib * ADDS_PER_KIB;
+        Test(tag, Common::FormatString("Straight-line code, %u KiB", (unsigned)block.kib),
+             [&] { return block.kernel(BLOCK_ITERATIONS); }, adds * BLOCK_ITERATIONS);
+
+        u64 ticks = Benchmark::BestTicks(KERNEL_RUNS, [&] { block.kernel(BLOCK_ITERATIONS); });
+        table.AddRow({ "Straight-line code",
+                       Common::FormatString("%u KiB (%s/instr)", (unsigned)block.kib,
+                                            CyclesPer(ticks, adds * BLOCK_ITERATIONS).c_str()),
+                       CyclesPer(ticks, BLOCK_ITERATIONS) });
+    }
+
+    table.Log();
+}
+
+} // namespace
+} // namespace
@@ -0,0 +1,22 @@
+#pragma once
+
+// Kept free of 3DS headers so that the reference models stay buildable on the host.
+
+#include <cstdint>
+
+namespace CPU {
+
+/// CPSR condition flags, sticky saturation flag and SIMD greater-than-or-equal flags
+static const uint32_t CPSR_N = 1u << 31;
+static const uint32_t CPSR_Z = 1u << 30;
+static const uint32_t CPSR_C = 1u << 29;
+static const uint32_t CPSR_V = 1u << 28;
+static const uint32_t CPSR_Q = 1u << 27;
+static const uint32_t CPSR_GE_SHIFT = 16;
+static const uint32_t CPSR_GE_MASK = 0xFu << CPSR_GE_SHIFT;
+
+static const uint32_t CPSR_NZCV_MASK = CPSR_N | CPSR_Z | CPSR_C | CPSR_V;
+/// Every bit user code can write with MSR and that the tests check
+static const uint32_t CPSR_FLAGS_MASK = CPSR_NZCV_MASK | CPSR_Q | CPSR_GE_MASK;
+
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+// Kept free of 3DS headers, so that host tools generating test vectors see the same list.
+
+#include <cstdint>
+
+#include "tests/cpu/alu_ref.h"
+#include "tests/cpu/media_ref.h"
+
+namespace CPU {
+
+/// Models an instruction that must leave every flag as it found it
+template <uint32_t (*Func)(uint32_t, uint32_t)>
+uint32_t PreservesFlags(uint32_t rn, uint32_t rm, uint32_t*)
+{
+    return Func(rn, rm);
+}
+
+}
+
+/**
+ * Instructions of the form `mnemonic Rd, Rn, Rm` with a reference model that updates the flags,
+ * as X(name, mnemonic, reference). The position of an instruction in the list is its opcode id
+ * in vector files, so new instructions must be appended.
+ */
+#define CPU_FLAG_OPS(X) \
+    X(Adds,    "ADDS",    CPU::AluRef::Adds) \
+    X(Adcs,    "ADCS",    CPU::AluRef::Adcs) \
+    X(Subs,    "SUBS",    CPU::AluRef::Subs) \
+    X(Sbcs,    "SBCS",    CPU::AluRef::Sbcs) \
+    X(Sadd16,  "SADD16",  CPU::MediaRef::Sadd16) \
+    X(Ssub16,  "SSUB16",  CPU::MediaRef::Ssub16) \
+    X(Sasx,    "SASX",    CPU::MediaRef::Sasx) \
+    X(Ssax,    "SSAX",    CPU::MediaRef::Ssax) \
+    X(Uadd16,  "UADD16",  CPU::MediaRef::Uadd16) \
+    X(Usub16,  "USUB16",  CPU::MediaRef::Usub16) \
+    X(Uasx,    "UASX",    CPU::MediaRef::Uasx) \
+    X(Usax,    "USAX",    CPU::MediaRef::Usax) \
+    X(Sadd8,   "SADD8",   CPU::MediaRef::Sadd8) \
+    X(Ssub8,   "SSUB8",   CPU::MediaRef::Ssub8) \
+    X(Uadd8,   "UADD8",   CPU::MediaRef::Uadd8) \
+    X(Usub8,   "USUB8",   CPU::MediaRef::Usub8) \
+    X(Sel,     "SEL",     CPU::MediaRef::Sel) \
+    X(Qadd,    "QADD",    CPU::MediaRef::Qadd) \
+    X(Qsub,    "QSUB",    CPU::MediaRef::Qsub) \
+    X(Qdadd,   "QDADD",   CPU::MediaRef::Qdadd) \
+    X(Qdsub,   "QDSUB",   CPU::MediaRef::Qdsub) \
+    /* Lane-saturating instructions do not touch Q, and only the ones above touch GE */ \
+    X(Qadd16,  "QADD16",  CPU::PreservesFlags<CPU::MediaRef::Qadd16>) \
+    X(Qsub16,  "QSUB16",  CPU::PreservesFlags<CPU::MediaRef::Qsub16>) \
+    X(Qadd8,   "QADD8",   CPU::PreservesFlags<CPU::MediaRef::Qadd8>) \
+    X(Uqsub8,  "UQSUB8",  CPU::PreservesFlags<CPU::MediaRef::Uqsub8>) \
+    X(Usad8,   "USAD8",   CPU::PreservesFlags<CPU::MediaRef::Usad8>)
+
+namespace CPU {
+
+#define CPU_OP_MNEMONIC(name, mnemonic, reference) mnemonic,
+static const char* const FLAG_OP_MNEMONICS[] = { CPU_FLAG_OPS(CPU_OP_MNEMONIC) };
+#undef CPU_OP_MNEMONIC
+
+static const unsigned int NUM_FLAG_OPS = sizeof(FLAG_OP_MNEMONICS) / sizeof(FLAG_OP_MNEMONICS[0]);
+
+}
@@ -4,4 +4,39 @@ namespace CPU {
 namespace Integer {
 void TestAll();
 }
+
+/// Randomized operand sweeps of the media instructions against a reference model
+namespace MediaSweep {
+void TestAll();
+}
+
+/// Result and NZCV/Q/GE flags of flag-setting instructions against a reference model
+namespace FlagSetting {
+void TestAll();
+}
+
+/// VFP arithmetic, conversions, rounding and exception flags, and the cost of each operation
+namespace Vfp {
+void TestAll();
+}
+
+/// Flag-setting instructions against vectors streamed from hwtest_vectors.bin on the SD card
+namespace Vectors {
+void TestAll();
+}
+
+/// Exclusive monitor semantics, and the throughput of atomics and queues built on them
+namespace Atomics {
+void TestAll();
+}
+
+/// Cost of predicted and mispredicted branches, indirect dispatch, call depth and code size
+namespace Branch {
+void TestAll();
+}
+
+/// Load/store multiple, doubleword, unaligned and byte access semantics, and copy idiom speed
+namespace Memory {
+void TestAll();
+}
 }
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "tests/cpu/cpu_ops.h"
+#include "tests/cpu/flags.h"
+
+namespace CPU {
+namespace FlagOps {
+
+// One CPU::Flags::Run-compatible struct per entry of CPU_FLAG_OPS, named after it
+#define DECLARE_FLAG_OP(name, mnemonic, reference) FLAGS_OP(name, mnemonic, reference);
+CPU_FLAG_OPS(DECLARE_FLAG_OP)
+#undef DECLARE_FLAG_OP
+
+typedef Flags::Outcome (*Executor)(u32 rn, u32 rm, u32 cpsr_in);
+
+/// Hardware executors indexed by opcode id
+#define FLAG_OP_EXECUTOR(name, mnemonic, reference) name::Hardware,
+static const Executor EXECUTORS[] = { CPU_FLAG_OPS(FLAG_OP_EXECUTOR) };
+#undef FLAG_OP_EXECUTOR
+
+} // namespace
+} // namespace
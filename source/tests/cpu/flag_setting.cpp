@@ -0,0 +1,33 @@
+#include <string>
+
+#include <3ds.h>
+
+#include "tests/test.h"
+#include "tests/cpu/cputests.h"
+#include "tests/cpu/flag_ops.h"
+#include "tests/cpu/flags.h"
+
+namespace CPU {
+namespace FlagSetting {
+
+static const u32 SEED = 0xF1A65EED;
+// Random operand and flag combinations per instruction, on top of the edge cases
+static const u32 RANDOM_CASES = 1 << 16;
+
+template <typename Op>
+static void TestOp(const std::string& tag, const std::string& name)
+{
+    Test(tag, name, [&] { return Flags::LogReport(name, Flags::Run<Op>(SEED, RANDOM_CASES)); }, true);
+}
+
+void TestAll()
+{
+    const std::string tag = "Flags";
+
+#define TEST_FLAG_OP(name, mnemonic, reference) TestOp<FlagOps::name>(tag, mnemonic);
+    CPU_FLAG_OPS(TEST_FLAG_OP)
+#undef TEST_FLAG_OP
+}
+
+} // namespace
+} // namespace
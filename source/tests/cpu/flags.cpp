@@ -0,0 +1,36 @@
+#include "tests/cpu/flags.h"
+
+#include "output.h"
+#include "common/string_funcs.h"
+
+namespace CPU {
+namespace Flags {
+
+const u32 FLAG_INPUTS[] = {
+    0,
+    CPSR_FLAGS_MASK,
+    CPSR_N | CPSR_C | CPSR_Q | (0x5 << CPSR_GE_SHIFT),
+    CPSR_Z | CPSR_V | (0xA << CPSR_GE_SHIFT),
+};
+const u32 NUM_FLAG_INPUTS = sizeof(FLAG_INPUTS) / sizeof(FLAG_INPUTS[0]);
+
+bool LogReport(const std::string& name, const Report& report)
+{
+    for (u32 i = 0; i < report.mismatches && i < MAX_RECORDED_MISMATCHES; i++) {
+        const Mismatch& m = report.recorded[i];
+        LogToFile(Common::FormatString("MISMATCH %s: rn=%08X rm=%08X cpsr=%08X hw=%08X/%08X ref=%08X/%08X\n",
+                                       name.c_str(), (unsigned)m.rn, (unsigned)m.rm,
+                                       (unsigned)m.cpsr_in, (unsigned)m.hardware.rd,
+                                       (unsigned)m.hardware.cpsr, (unsigned)m.reference.rd,
+                                       (unsigned)m.reference.cpsr));
+    }
+    if (report.mismatches > MAX_RECORDED_MISMATCHES) {
+        LogToFile(Common::FormatString("MISMATCH %s: %u more of %u\n", name.c_str(),
+                                       (unsigned)(report.mismatches - MAX_RECORDED_MISMATCHES),
+                                       (unsigned)report.count));
+    }
+    return report.mismatches == 0;
+}
+
+} // namespace
+} // namespace
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <string>
+
+#include <3ds.h>
+
+#include "common/random.h"
+#include "tests/cpu/cpsr.h"
+#include "tests/cpu/operands.h"
+
+namespace CPU {
+namespace Flags {
+
+/// Destination register and the CPSR flags (masked by CPSR_FLAGS_MASK) after an instruction
+struct Outcome {
+    u32 rd;
+    u32 cpsr;
+
+    bool operator==(const Outcome& other) const { return rd == other.rd && cpsr == other.cpsr; }
+    bool operator!=(const Outcome& other) const { return !(*this == other); }
+};
+
+struct Mismatch {
+    u32 rn, rm, cpsr_in;
+    Outcome hardware;
+    Outcome reference;
+};
+
+static const u32 MAX_RECORDED_MISMATCHES = 4;
+
+struct Report {
+    u32 count;
+    u32 mismatches;
+    Mismatch recorded[MAX_RECORDED_MISMATCHES];
+};
+
+/// Flag states every pair of edge operands is run with
+extern const u32 FLAG_INPUTS[];
+extern const u32 NUM_FLAG_INPUTS;
+
+/**
+ * Runs `Op` over every pair of edge operands with each of the FLAG_INPUTS, and then over
+ * `random_count` random operands and flags drawn from `seed`. `Op::Hardware(rn, rm, cpsr_in)`
+ * and `Op::Reference(rn, rm, cpsr_in)` both return an Outcome, and are inlined into the loop so
+ * each case costs little more than the MSR, the instruction and the MRS.
+ */
+template <typename Op>
+Report Run(u32 seed, u32 random_count)
+{
+    Report report = {};
+
+    auto check = [&](u32 rn, u32 rm, u32 cpsr_in) {
+        Outcome hardware = Op::Hardware(rn, rm, cpsr_in);
+        Outcome reference = Op::Reference(rn, rm, cpsr_in);
+        if (hardware != reference) {
+            if (report.mismatches < MAX_RECORDED_MISMATCHES)
+                report.recorded[report.mismatches] = { rn, rm, cpsr_in, hardware, reference };
+            report.mismatches++;
+        }
+        report.count++;
+    };
+
+    for (u32 i = 0; i < NUM_EDGE_OPERANDS; i++)
+        for (u32 j = 0; j < NUM_EDGE_OPERANDS; j++)
+            for (u32 k = 0; k < NUM_FLAG_INPUTS; k++)
+                check(EDGE_OPERANDS[i], EDGE_OPERANDS[j], FLAG_INPUTS[k]);
+
+    Common::XorShift32 rng(seed);
+    for (u32 i = 0; i < random_count; i++) {
+        u32 rn = NextOperand(rng);
+        u32 rm = NextOperand(rng);
+        check(rn, rm, rng.Next() & CPSR_FLAGS_MASK);
+    }
+
+    return report;
+}
+
+/// Logs one line per recorded mismatch of `name`, and returns whether there were none.
+bool LogReport(const std::string& name, const Report& report);
+
+} // namespace
+} // namespace
+
+/**
+ * Declares a struct usable with CPU::Flags::Run for the instruction `mnemonic Rd, Rn, Rm`.
+ * The flags are set with MSR right before it and read back with MRS right after it.
+ * `reference(rn, rm, &cpsr)` models the instruction, updating `cpsr` as it would.
+ */
+#define FLAGS_OP(op_name, mnemonic, reference) \
+    struct op_name { \
+        static CPU::Flags::Outcome Hardware(u32 rn, u32 rm, u32 cpsr_in) { \
+            CPU::Flags::Outcome out; \
+            asm volatile ("MSR CPSR_fs, %[in]\n\t" \
+                          mnemonic " %[rd], %[rn], %[rm]\n\t" \
+                          "MRS %[cpsr], CPSR" \
+                          : [rd] "=r"(out.rd), [cpsr] "=r"(out.cpsr) \
+                          : [in] "r"(cpsr_in), [rn] "r"(rn), [rm] "r"(rm) \
+                          : "cc"); \
+            out.cpsr &= CPU::CPSR_FLAGS_MASK; \
+            return out; \
+        } \
+        static CPU::Flags::Outcome Reference(u32 rn, u32 rm, u32 cpsr_in) { \
+            CPU::Flags::Outcome out; \
+            u32 cpsr = cpsr_in; \
+            out.rd = reference(rn, rm, &cpsr); \
+            out.cpsr = cpsr; \
+            return out; \
+        } \
+    }
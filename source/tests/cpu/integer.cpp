@@ -274,18 +274,18 @@ static bool Uxtb16() {
 void TestAll() {
     const std::string tag = "Integer";
 
-    Test(tag, "ADD", Add(), true);
-    Test(tag, "SUB", Sub(), true);
-    Test(tag, "MUL", Mul(), true);
-    Test(tag, "QADD16", Qadd16(), true);
-    Test(tag, "QSUB16", Qsub16(), true);
-    Test(tag, "SASX", Sasx(), true);
-    Test(tag, "SSAX", Ssax(), true);
-    Test(tag, "UQSUB8", Uqsub8(), true);
-    Test(tag, "USAD8", Usad8(), true);
-    Test(tag, "USADA8", Usada8(), true);
-    Test(tag, "UXTAB16", Uxtab16(), true);
-    Test(tag, "UXTB16", Uxtb16(), true);
+    Test(tag, "ADD", Add, true);
+    Test(tag, "SUB", Sub, true);
+    Test(tag, "MUL", Mul, true);
+    Test(tag, "QADD16", Qadd16, true);
+    Test(tag, "QSUB16", Qsub16, true);
+    Test(tag, "SASX", Sasx, true);
+    Test(tag, "SSAX", Ssax, true);
+    Test(tag, "UQSUB8", Uqsub8, true);
+    Test(tag, "USAD8", Usad8, true);
+    Test(tag, "USADA8", Usada8, true);
+    Test(tag, "UXTAB16", Uxtab16, true);
+    Test(tag, "UXTB16", Uxtb16, true);
 }
 
 }
@@ -0,0 +1,365 @@
+#pragma once
+
+// Bit-exact reference model of the ARMv6 media (SIMD) instructions, following the pseudocode
+// of the ARM Architecture Reference Manual. Kept free of 3DS headers so that host tools can
+// build it too; operands are named as in the manual (Rd = op(Rn, Rm)). Models of instructions
+// that read or write the Q or GE flags take the CPSR by pointer.
+
+#include <cstdint>
+
+#include "tests/cpu/cpsr.h"
+
+namespace CPU {
+namespace MediaRef {
+
+inline uint32_t Ror(uint32_t value, unsigned int amount)
+{
+    amount &= 31;
+    return amount == 0 ? value : (value >> amount) | (value << (32 - amount));
+}
+
+/// Signed halfword `i` (0 = bits 15:0) of `value`
+inline int32_t SHalf(uint32_t value, int i) { return (int16_t)(value >> (i * 16)); }
+inline uint32_t UHalf(uint32_t value, int i) { return (value >> (i * 16)) & 0xFFFF; }
+
+/// Signed byte `i` (0 = bits 7:0) of `value`
+inline int32_t SByte(uint32_t value, int i) { return (int8_t)(value >> (i * 8)); }
+inline uint32_t UByte(uint32_t value, int i) { return (value >> (i * 8)) & 0xFF; }
+
+inline int32_t SignedSat(int32_t value, int bits)
+{
+    const int32_t max = (1 << (bits - 1)) - 1;
+    const int32_t min = -(1 << (bits - 1));
+    return value > max ? max : value < min ? min : value;
+}
+
+inline int32_t UnsignedSat(int32_t value, int bits)
+{
+    const int32_t max = (1 << bits) - 1;
+    return value > max ? max : value < 0 ? 0 : value;
+}
+
+inline uint32_t PackHalves(int32_t lo, int32_t hi)
+{
+    return ((uint32_t)lo & 0xFFFF) | ((uint32_t)hi << 16);
+}
+
+inline uint32_t PackBytes(const int32_t bytes[4])
+{
+    return ((uint32_t)bytes[0] & 0xFF) | (((uint32_t)bytes[1] & 0xFF) << 8) |
+           (((uint32_t)bytes[2] & 0xFF) << 16) | ((uint32_t)bytes[3] << 24);
+}
+
+// Saturating
+
+inline uint32_t Qadd16(uint32_t rn, uint32_t rm)
+{
+    return PackHalves(SignedSat(SHalf(rn, 0) + SHalf(rm, 0), 16),
+                      SignedSat(SHalf(rn, 1) + SHalf(rm, 1), 16));
+}
+
+inline uint32_t Qsub16(uint32_t rn, uint32_t rm)
+{
+    return PackHalves(SignedSat(SHalf(rn, 0) - SHalf(rm, 0), 16),
+                      SignedSat(SHalf(rn, 1) - SHalf(rm, 1), 16));
+}
+
+inline uint32_t Qasx(uint32_t rn, uint32_t rm)
+{
+    return PackHalves(SignedSat(SHalf(rn, 0) - SHalf(rm, 1), 16),
+                      SignedSat(SHalf(rn, 1) + SHalf(rm, 0), 16));
+}
+
+inline uint32_t Qsax(uint32_t rn, uint32_t rm)
+{
+    return PackHalves(SignedSat(SHalf(rn, 0) + SHalf(rm, 1), 16),
+                      SignedSat(SHalf(rn, 1) - SHalf(rm, 0), 16));
+}
+
+inline uint32_t Qadd8(uint32_t rn, uint32_t rm)
+{
+    int32_t bytes[4];
+    for (int i = 0; i < 4; i++)
+        bytes[i] = SignedSat(SByte(rn, i) + SByte(rm, i), 8);
+    return PackBytes(bytes);
+}
+
+inline uint32_t Qsub8(uint32_t rn, uint32_t rm)
+{
+    int32_t bytes[4];
+    for (int i = 0; i < 4; i++)
+        bytes[i] = SignedSat(SByte(rn, i) - SByte(rm, i), 8);
+    return PackBytes(bytes);
+}
+
+inline uint32_t Uqadd16(uint32_t rn, uint32_t rm)
+{
+    return PackHalves(UnsignedSat(UHalf(rn, 0) + UHalf(rm, 0), 16),
+                      UnsignedSat(UHalf(rn, 1) + UHalf(rm, 1), 16));
+}
+
+inline uint32_t Uqsub16(uint32_t rn, uint32_t rm)
+{
+    return PackHalves(UnsignedSat((int32_t)UHalf(rn, 0) - (int32_t)UHalf(rm, 0), 16),
+                      UnsignedSat((int32_t)UHalf(rn, 1) - (int32_t)UHalf(rm, 1), 16));
+}
+
+inline uint32_t Uqadd8(uint32_t rn, uint32_t rm)
+{
+    int32_t bytes[4];
+    for (int i = 0; i < 4; i++)
+        bytes[i] = UnsignedSat(UByte(rn, i) + UByte(rm, i), 8);
+    return PackBytes(bytes);
+}
+
+inline uint32_t Uqsub8(uint32_t rn, uint32_t rm)
+{
+    int32_t bytes[4];
+    for (int i = 0; i < 4; i++)
+        bytes[i] = UnsignedSat((int32_t)UByte(rn, i) - (int32_t)UByte(rm, i), 8);
+    return PackBytes(bytes);
+}
+
+// Modular
+
+inline uint32_t Sasx(uint32_t rn, uint32_t rm)
+{
+    return PackHalves(SHalf(rn, 0) - SHalf(rm, 1), SHalf(rn, 1) + SHalf(rm, 0));
+}
+
+inline uint32_t Ssax(uint32_t rn, uint32_t rm)
+{
+    return PackHalves(SHalf(rn, 0) + SHalf(rm, 1), SHalf(rn, 1) - SHalf(rm, 0));
+}
+
+// Halving
+
+inline uint32_t Shadd16(uint32_t rn, uint32_t rm)
+{
+    return PackHalves((SHalf(rn, 0) + SHalf(rm, 0)) >> 1, (SHalf(rn, 1) + SHalf(rm, 1)) >> 1);
+}
+
+inline uint32_t Uhadd8(uint32_t rn, uint32_t rm)
+{
+    int32_t bytes[4];
+    for (int i = 0; i < 4; i++)
+        bytes[i] = (UByte(rn, i) + UByte(rm, i)) >> 1;
+    return PackBytes(bytes);
+}
+
+// Sum of absolute differences
+
+inline uint32_t Usada8(uint32_t rn, uint32_t rm, uint32_t ra)
+{
+    uint32_t sum = ra;
+    for (int i = 0; i < 4; i++) {
+        int32_t diff = (int32_t)UByte(rn, i) - (int32_t)UByte(rm, i);
+        sum += diff < 0 ? -diff : diff;
+    }
+    return sum;
+}
+
+inline uint32_t Usad8(uint32_t rn, uint32_t rm)
+{
+    return Usada8(rn, rm, 0);
+}
+
+// Extend (and add), `rotation` being one of 0, 8, 16 or 24
+
+inline uint32_t Sxtab16(uint32_t rn, uint32_t rm, unsigned int rotation)
+{
+    uint32_t rotated = Ror(rm, rotation);
+    return PackHalves(SHalf(rn, 0) + SByte(rotated, 0), SHalf(rn, 1) + SByte(rotated, 2));
+}
+
+inline uint32_t Sxtb16(uint32_t rm, unsigned int rotation)
+{
+    return Sxtab16(0, rm, rotation);
+}
+
+inline uint32_t Uxtab16(uint32_t rn, uint32_t rm, unsigned int rotation)
+{
+    uint32_t rotated = Ror(rm, rotation);
+    return PackHalves(UHalf(rn, 0) + UByte(rotated, 0), UHalf(rn, 1) + UByte(rotated, 2));
+}
+
+inline uint32_t Uxtb16(uint32_t rm, unsigned int rotation)
+{
+    return Uxtab16(0, rm, rotation);
+}
+
+// GE-setting: each lane sets its GE bits when its result is non-negative (signed) or carries out
+// (unsigned additions) or does not borrow (unsigned subtractions)
+
+inline void SetGe(uint32_t* cpsr, uint32_t ge)
+{
+    *cpsr = (*cpsr & ~CPSR_GE_MASK) | (ge << CPSR_GE_SHIFT);
+}
+
+/// GE bits for two halfword lanes
+inline uint32_t GeHalves(bool lo, bool hi)
+{
+    return (lo ? 0x3 : 0) | (hi ? 0xC : 0);
+}
+
+inline uint32_t Sadd16(uint32_t rn, uint32_t rm, uint32_t* cpsr)
+{
+    int32_t lo = SHalf(rn, 0) + SHalf(rm, 0);
+    int32_t hi = SHalf(rn, 1) + SHalf(rm, 1);
+    SetGe(cpsr, GeHalves(lo >= 0, hi >= 0));
+    return PackHalves(lo, hi);
+}
+
+inline uint32_t Ssub16(uint32_t rn, uint32_t rm, uint32_t* cpsr)
+{
+    int32_t lo = SHalf(rn, 0) - SHalf(rm, 0);
+    int32_t hi = SHalf(rn, 1) - SHalf(rm, 1);
+    SetGe(cpsr, GeHalves(lo >= 0, hi >= 0));
+    return PackHalves(lo, hi);
+}
+
+inline uint32_t Sasx(uint32_t rn, uint32_t rm, uint32_t* cpsr)
+{
+    int32_t lo = SHalf(rn, 0) - SHalf(rm, 1);
+    int32_t hi = SHalf(rn, 1) + SHalf(rm, 0);
+    SetGe(cpsr, GeHalves(lo >= 0, hi >= 0));
+    return PackHalves(lo, hi);
+}
+
+inline uint32_t Ssax(uint32_t rn, uint32_t rm, uint32_t* cpsr)
+{
+    int32_t lo = SHalf(rn, 0) + SHalf(rm, 1);
+    int32_t hi = SHalf(rn, 1) - SHalf(rm, 0);
+    SetGe(cpsr, GeHalves(lo >= 0, hi >= 0));
+    return PackHalves(lo, hi);
+}
+
+inline uint32_t Uadd16(uint32_t rn, uint32_t rm, uint32_t* cpsr)
+{
+    uint32_t lo = UHalf(rn, 0) + UHalf(rm, 0);
+    uint32_t hi = UHalf(rn, 1) + UHalf(rm, 1);
+    SetGe(cpsr, GeHalves(lo >= 0x10000, hi >= 0x10000));
+    return PackHalves(lo, hi);
+}
+
+inline uint32_t Usub16(uint32_t rn, uint32_t rm, uint32_t* cpsr)
+{
+    int32_t lo = (int32_t)UHalf(rn, 0) - (int32_t)UHalf(rm, 0);
+    int32_t hi = (int32_t)UHalf(rn, 1) - (int32_t)UHalf(rm, 1);
+    SetGe(cpsr, GeHalves(lo >= 0, hi >= 0));
+    return PackHalves(lo, hi);
+}
+
+inline uint32_t Uasx(uint32_t rn, uint32_t rm, uint32_t* cpsr)
+{
+    int32_t lo = (int32_t)UHalf(rn, 0) - (int32_t)UHalf(rm, 1);
+    uint32_t hi = UHalf(rn, 1) + UHalf(rm, 0);
+    SetGe(cpsr, GeHalves(lo >= 0, hi >= 0x10000));
+    return PackHalves(lo, hi);
+}
+
+inline uint32_t Usax(uint32_t rn, uint32_t rm, uint32_t* cpsr)
+{
+    uint32_t lo = UHalf(rn, 0) + UHalf(rm, 1);
+    int32_t hi = (int32_t)UHalf(rn, 1) - (int32_t)UHalf(rm, 0);
+    SetGe(cpsr, GeHalves(lo >= 0x10000, hi >= 0));
+    return PackHalves(lo, hi);
+}
+
+inline uint32_t Sadd8(uint32_t rn, uint32_t rm, uint32_t* cpsr)
+{
+    int32_t bytes[4];
+    uint32_t ge = 0;
+    for (int i = 0; i < 4; i++) {
+        bytes[i] = SByte(rn, i) + SByte(rm, i);
+        ge |= (bytes[i] >= 0) << i;
+    }
+    SetGe(cpsr, ge);
+    return PackBytes(bytes);
+}
+
+inline uint32_t Ssub8(uint32_t rn, uint32_t rm, uint32_t* cpsr)
+{
+    int32_t bytes[4];
+    uint32_t ge = 0;
+    for (int i = 0; i < 4; i++) {
+        bytes[i] = SByte(rn, i) - SByte(rm, i);
+        ge |= (bytes[i] >= 0) << i;
+    }
+    SetGe(cpsr, ge);
+    return PackBytes(bytes);
+}
+
+inline uint32_t Uadd8(uint32_t rn, uint32_t rm, uint32_t* cpsr)
+{
+    int32_t bytes[4];
+    uint32_t ge = 0;
+    for (int i = 0; i < 4; i++) {
+        bytes[i] = UByte(rn, i) + UByte(rm, i);
+        ge |= (bytes[i] >= 0x100) << i;
+    }
+    SetGe(cpsr, ge);
+    return PackBytes(bytes);
+}
+
+inline uint32_t Usub8(uint32_t rn, uint32_t rm, uint32_t* cpsr)
+{
+    int32_t bytes[4];
+    uint32_t ge = 0;
+    for (int i = 0; i < 4; i++) {
+        bytes[i] = (int32_t)UByte(rn, i) - (int32_t)UByte(rm, i);
+        ge |= (bytes[i] >= 0) << i;
+    }
+    SetGe(cpsr, ge);
+    return PackBytes(bytes);
+}
+
+/// Picks each byte from `rn` where its GE bit is set, and from `rm` otherwise
+inline uint32_t Sel(uint32_t rn, uint32_t rm, uint32_t* cpsr)
+{
+    uint32_t ge = (*cpsr & CPSR_GE_MASK) >> CPSR_GE_SHIFT;
+    uint32_t result = 0;
+    for (int i = 0; i < 4; i++)
+        result |= (((ge >> i) & 1) ? UByte(rn, i) : UByte(rm, i)) << (i * 8);
+    return result;
+}
+
+// Q-setting word saturation. Q is sticky: it is only ever set here, never cleared.
+
+inline int32_t SignedSatQ(int64_t value, uint32_t* cpsr)
+{
+    if (value > INT32_MAX || value < INT32_MIN) {
+        *cpsr |= CPSR_Q;
+        return value > INT32_MAX ? INT32_MAX : INT32_MIN;
+    }
+    return (int32_t)value;
+}
+
+/// QADD Rd, Rm, Rn: Rm + Rn
+inline uint32_t Qadd(uint32_t rm, uint32_t rn, uint32_t* cpsr)
+{
+    return SignedSatQ((int64_t)(int32_t)rm + (int32_t)rn, cpsr);
+}
+
+/// QSUB Rd, Rm, Rn: Rm - Rn
+inline uint32_t Qsub(uint32_t rm, uint32_t rn, uint32_t* cpsr)
+{
+    return SignedSatQ((int64_t)(int32_t)rm - (int32_t)rn, cpsr);
+}
+
+/// QDADD Rd, Rm, Rn: Rm + 2 * Rn, with the doubling saturated too
+inline uint32_t Qdadd(uint32_t rm, uint32_t rn, uint32_t* cpsr)
+{
+    int32_t doubled = SignedSatQ((int64_t)(int32_t)rn * 2, cpsr);
+    return SignedSatQ((int64_t)(int32_t)rm + doubled, cpsr);
+}
+
+/// QDSUB Rd, Rm, Rn: Rm - 2 * Rn, with the doubling saturated too
+inline uint32_t Qdsub(uint32_t rm, uint32_t rn, uint32_t* cpsr)
+{
+    int32_t doubled = SignedSatQ((int64_t)(int32_t)rn * 2, cpsr);
+    return SignedSatQ((int64_t)(int32_t)rm - doubled, cpsr);
+}
+
+} // namespace
+} // namespace
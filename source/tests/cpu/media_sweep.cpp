@@ -0,0 +1,139 @@
+#include <string>
+
+#include <3ds.h>
+
+#include "tests/test.h"
+#include "tests/cpu/cputests.h"
+#include "tests/cpu/media_ref.h"
+#include "tests/cpu/sweep.h"
+
+namespace CPU {
+namespace MediaSweep {
+
+// Fixed so that a reported mismatch can be reproduced from its index
+static const u32 SEED = 0x3D5C0DE5;
+// Random operand triples per instruction, on top of every pair of edge operands
+static const u32 RANDOM_OPERANDS = 1 << 20;
+
+// Rd = op(Rn, Rm)
+#define BINARY_OP(op_name, mnemonic, reference) \
+    struct op_name { \
+        static u32 Hardware(u32 rn, u32 rm, u32) { \
+            u32 rd; \
+            asm (mnemonic " %[rd], %[rn], %[rm]" : [rd] "=r"(rd) : [rn] "r"(rn), [rm] "r"(rm)); \
+            return rd; \
+        } \
+        static u32 Reference(u32 rn, u32 rm, u32) { return MediaRef::reference(rn, rm); } \
+    }
+
+BINARY_OP(Qadd16Op,  "QADD16",  Qadd16);
+BINARY_OP(Qsub16Op,  "QSUB16",  Qsub16);
+BINARY_OP(QasxOp,    "QASX",    Qasx);
+BINARY_OP(QsaxOp,    "QSAX",    Qsax);
+BINARY_OP(Qadd8Op,   "QADD8",   Qadd8);
+BINARY_OP(Qsub8Op,   "QSUB8",   Qsub8);
+BINARY_OP(Uqadd16Op, "UQADD16", Uqadd16);
+BINARY_OP(Uqsub16Op, "UQSUB16", Uqsub16);
+BINARY_OP(Uqadd8Op,  "UQADD8",  Uqadd8);
+BINARY_OP(Uqsub8Op,  "UQSUB8",  Uqsub8);
+BINARY_OP(SasxOp,    "SASX",    Sasx);
+BINARY_OP(SsaxOp,    "SSAX",    Ssax);
+BINARY_OP(Shadd16Op, "SHADD16", Shadd16);
+BINARY_OP(Uhadd8Op,  "UHADD8",  Uhadd8);
+BINARY_OP(Usad8Op,   "USAD8",   Usad8);
+
+#undef BINARY_OP
+
+struct Usada8Op {
+    static u32 Hardware(u32 rn, u32 rm, u32 ra) {
+        u32 rd;
+        asm ("USADA8 %[rd], %[rn], %[rm], %[ra]" : [rd] "=r"(rd) : [rn] "r"(rn), [rm] "r"(rm), [ra] "r"(ra));
+        return rd;
+    }
+    static u32 Reference(u32 rn, u32 rm, u32 ra) { return MediaRef::Usada8(rn, rm, ra); }
+};
+
+// The rotation is part of the encoding, so each one gets its own instantiation
+template <unsigned int Rotation>
+struct Uxtab16Op {
+    static u32 Hardware(u32 rn, u32 rm, u32) {
+        u32 rd;
+        asm ("UXTAB16 %[rd], %[rn], %[rm], ROR %[rot]" : [rd] "=r"(rd) : [rn] "r"(rn), [rm] "r"(rm), [rot] "i"(Rotation));
+        return rd;
+    }
+    static u32 Reference(u32 rn, u32 rm, u32) { return MediaRef::Uxtab16(rn, rm, Rotation); }
+};
+
+template <unsigned int Rotation>
+struct Sxtab16Op {
+    static u32 Hardware(u32 rn, u32 rm, u32) {
+        u32 rd;
+        asm ("SXTAB16 %[rd], %[rn], %[rm], ROR %[rot]" : [rd] "=r"(rd) : [rn] "r"(rn), [rm] "r"(rm), [rot] "i"(Rotation));
+        return rd;
+    }
+    static u32 Reference(u32 rn, u32 rm, u32) { return MediaRef::Sxtab16(rn, rm, Rotation); }
+};
+
+template <unsigned int Rotation>
+struct Uxtb16Op {
+    static u32 Hardware(u32, u32 rm, u32) {
+        u32 rd;
+        asm ("UXTB16 %[rd], %[rm], ROR %[rot]" : [rd] "=r"(rd) : [rm] "r"(rm), [rot] "i"(Rotation));
+        return rd;
+    }
+    static u32 Reference(u32, u32 rm, u32) { return MediaRef::Uxtb16(rm, Rotation); }
+};
+
+template <unsigned int Rotation>
+struct Sxtb16Op {
+    static u32 Hardware(u32, u32 rm, u32) {
+        u32 rd;
+        asm ("SXTB16 %[rd], %[rm], ROR %[rot]" : [rd] "=r"(rd) : [rm] "r"(rm), [rot] "i"(Rotation));
+        return rd;
+    }
+    static u32 Reference(u32, u32 rm, u32) { return MediaRef::Sxtb16(rm, Rotation); }
+};
+
+template <typename Op>
+static void TestOp(const std::string& tag, const std::string& name)
+{
+    Test(tag, name, [&] { return Sweep::LogReport(name, Sweep::Run<Op>(SEED, RANDOM_OPERANDS)); }, true);
+}
+
+template <template <unsigned int> class Op>
+static void TestRotations(const std::string& tag, const std::string& name)
+{
+    TestOp<Op<0>>(tag, name);
+    TestOp<Op<8>>(tag, name + " ROR8");
+    TestOp<Op<16>>(tag, name + " ROR16");
+    TestOp<Op<24>>(tag, name + " ROR24");
+}
+
+void TestAll()
+{
+    const std::string tag = "Media";
+
+    TestOp<Qadd16Op>(tag, "QADD16");
+    TestOp<Qsub16Op>(tag, "QSUB16");
+    TestOp<QasxOp>(tag, "QASX");
+    TestOp<QsaxOp>(tag, "QSAX");
+    TestOp<Qadd8Op>(tag, "QADD8");
+    TestOp<Qsub8Op>(tag, "QSUB8");
+    TestOp<Uqadd16Op>(tag, "UQADD16");
+    TestOp<Uqsub16Op>(tag, "UQSUB16");
+    TestOp<Uqadd8Op>(tag, "UQADD8");
+    TestOp<Uqsub8Op>(tag, "UQSUB8");
+    TestOp<SasxOp>(tag, "SASX");
+    TestOp<SsaxOp>(tag, "SSAX");
+    TestOp<Shadd16Op>(tag, "SHADD16");
+    TestOp<Uhadd8Op>(tag, "UHADD8");
+    TestOp<Usad8Op>(tag, "USAD8");
+    TestOp<Usada8Op>(tag, "USADA8");
+    TestRotations<Uxtab16Op>(tag, "UXTAB16");
+    TestRotations<Sxtab16Op>(tag, "SXTAB16");
+    TestRotations<Uxtb16Op>(tag, "UXTB16");
+    TestRotations<Sxtb16Op>(tag, "SXTB16");
+}
+
+} // namespace
+} // namespace
@@ -0,0 +1,483 @@
+#include <cstring>
+#include <string>
+
+#include <3ds.h>
+
+#include "output.h"
+#include "common/string_funcs.h"
+#include "tests/benchmark.h"
+#include "tests/test.h"
+#include "tests/cpu/cputests.h"
+
+namespace CPU {
+namespace Memory {
+
+// Bytes copied by each copy kernel; source and destination together fit the data cache
+static const u32 COPY_SIZE = 4096;
+static const int KERNEL_RUNS = 16;
+
+// Test pattern with a mix of set and clear top bits, so sign extension shows
+static u8 pattern[64] __attribute__((aligned(8)));
+static u8 scratch[64] __attribute__((aligned(8)));
+
+static void FillPattern()
+{
+    for (u32 i = 0; i < sizeof(pattern); i++)
+        pattern[i] = (u8)(0x81 + i * 0x3B);
+    memset(scratch, 0xEE, sizeof(scratch));
+}
+
+/// Little-endian word made of the pattern bytes at `offset`, as an unaligned load sees it.
+static u32 PatternWord(u32 offset)
+{
+    return pattern[offset] | (pattern[offset + 1] << 8) | (pattern[offset + 2] << 16) | ((u32)pattern[offset + 3] << 24);
+}
+
+static u32 PatternHalfword(u32 offset)
+{
+    return pattern[offset] | (pattern[offset + 1] << 8);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Load/store multiple
+
+// Each loads four words with writeback and stores them where C can check them
+#define LOAD_MULTIPLE(name, mode) \
+    static const u8* name(const u8* base, u32* out) \
+    { \
+        asm volatile("ldm" mode " %[base]!, {r4-r7}\n" \
+                     "stmia %[out], {r4-r7}\n" \
+                     : [base] "+r"(base) : [out] "r"(out) : "r4", "r5", "r6", "r7", "memory"); \
+        return base; \
+    }
+
+#define STORE_MULTIPLE(name, mode) \
+    static u8* name(u8* base, const u32* in) \
+    { \
+        asm volatile("ldmia %[in], {r4-r7}\n" \
+                     "stm" mode " %[base]!, {r4-r7}\n" \
+                     : [base] "+r"(base) : [in] "r"(in) : "r4", "r5", "r6", "r7", "memory"); \
+        return base; \
+    }
+
+LOAD_MULTIPLE(LoadMultipleIA, "ia")
+LOAD_MULTIPLE(LoadMultipleIB, "ib")
+LOAD_MULTIPLE(LoadMultipleDA, "da")
+LOAD_MULTIPLE(LoadMultipleDB, "db")
+STORE_MULTIPLE(StoreMultipleIA, "ia")
+STORE_MULTIPLE(StoreMultipleIB, "ib")
+STORE_MULTIPLE(StoreMultipleDA, "da")
+STORE_MULTIPLE(StoreMultipleDB, "db")
+
+#undef LOAD_MULTIPLE
+#undef STORE_MULTIPLE
+
+struct MultipleMode {
+    const char* name;
+    const u8* (*load)(const u8*, u32*);
+    u8* (*store)(u8*, const u32*);
+    s32 first_offset;   ///< Offset of the lowest word accessed from the base
+    s32 writeback;      ///< Change of the base register
+};
+
+static const MultipleMode MULTIPLE_MODES[] = {
+    { "IA", LoadMultipleIA, StoreMultipleIA,   0,  16 },
+    { "IB", LoadMultipleIB, StoreMultipleIB,   4,  16 },
+    { "DA", LoadMultipleDA, StoreMultipleDA, -12, -16 },
+    { "DB", LoadMultipleDB, StoreMultipleDB, -16, -16 },
+};
+
+static bool TestLoadMultiple(const MultipleMode& mode)
+{
+    FillPattern();
+    const u8* base = pattern + 32;
+    u32 loaded[4];
+    const u8* new_base = mode.load(base, loaded);
+
+    SoftAssert(new_base == base + mode.writeback);
+    for (u32 i = 0; i < 4; i++)
+        SoftAssert(loaded[i] == PatternWord(32 + mode.first_offset + i * 4));
+    return true;
+}
+
+static bool TestStoreMultiple(const MultipleMode& mode)
+{
+    FillPattern();
+    u8* base = scratch + 32;
+    const u32 values[4] = { 0x11111111, 0x22222222, 0x33333333, 0x44444444 };
+    u8* new_base = mode.store(base, values);
+
+    SoftAssert(new_base == base + mode.writeback);
+    for (s32 offset = 0; offset < (s32)sizeof(scratch); offset += 4) {
+        s32 index = (offset - (32 + mode.first_offset)) / 4;
+        u32 word;
+        memcpy(&word, scratch + offset, 4);
+        if (offset >= 32 + mode.first_offset && index < 4)
+            SoftAssert(word == values[index]);
+        else
+            SoftAssert(word == 0xEEEEEEEE);
+    }
+    return true;
+}
+
+// With the base register lowest in the list, STM stores its value from before the writeback
+static bool TestStoreMultipleBaseInList()
+{
+    u32 stored[2] __attribute__((aligned(4))) = {};
+    u32 base_after;
+    asm volatile("mov r4, %[target]\n"
+                 "mov r5, #0x55\n"
+                 "stmia r4!, {r4, r5}\n"
+                 "mov %[base_after], r4\n"
+                 : [base_after] "=r"(base_after) : [target] "r"(stored) : "r4", "r5", "memory");
+    SoftAssert(stored[0] == (u32)(uintptr_t)stored);
+    SoftAssert(stored[1] == 0x55);
+    SoftAssert(base_after == (u32)(uintptr_t)(stored + 2));
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Doubleword
+
+static u64 LoadDoubleword(const u8* address)
+{
+    u64 value;
+    asm volatile("ldrd %[value], %H[value], [%[address]]"
+                 : [value] "=r"(value) : [address] "r"(address) : "memory");
+    return value;
+}
+
+static u64 PatternDoubleword(u32 offset)
+{
+    return PatternWord(offset) | ((u64)PatternWord(offset + 4) << 32);
+}
+
+static bool TestDoubleword()
+{
+    FillPattern();
+    SoftAssert(LoadDoubleword(pattern + 8) == PatternDoubleword(8));
+    // Word alignment is enough while unaligned access is enabled
+    SoftAssert(LoadDoubleword(pattern + 12) == PatternDoubleword(12));
+
+    const u8* base = pattern + 16;
+    u64 value;
+    asm volatile("ldrd %[value], %H[value], [%[base]], #8"
+                 : [value] "=r"(value), [base] "+r"(base) : : "memory");
+    SoftAssert(value == PatternDoubleword(16));
+    SoftAssert(base == pattern + 24);
+
+    u8* store_base = scratch + 8;
+    value = 0x1122334455667788ULL;
+    asm volatile("strd %[value], %H[value], [%[base], #8]!"
+                 : [base] "+r"(store_base) : [value] "r"(value) : "memory");
+    SoftAssert(store_base == scratch + 16);
+    u64 stored;
+    memcpy(&stored, scratch + 16, 8);
+    SoftAssert(stored == value);
+    SoftAssert(scratch[15] == 0xEE && scratch[24] == 0xEE);
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Unaligned word and halfword
+
+static u32 LoadWord(const u8* address)
+{
+    u32 value;
+    asm volatile("ldr %[value], [%[address]]" : [value] "=r"(value) : [address] "r"(address) : "memory");
+    return value;
+}
+
+static u32 LoadHalfword(const u8* address)
+{
+    u32 value;
+    asm volatile("ldrh %[value], [%[address]]" : [value] "=r"(value) : [address] "r"(address) : "memory");
+    return value;
+}
+
+static s32 LoadSignedHalfword(const u8* address)
+{
+    s32 value;
+    asm volatile("ldrsh %[value], [%[address]]" : [value] "=r"(value) : [address] "r"(address) : "memory");
+    return value;
+}
+
+static void StoreWord(u8* address, u32 value)
+{
+    asm volatile("str %[value], [%[address]]" : : [address] "r"(address), [value] "r"(value) : "memory");
+}
+
+static void StoreHalfword(u8* address, u32 value)
+{
+    asm volatile("strh %[value], [%[address]]" : : [address] "r"(address), [value] "r"(value) : "memory");
+}
+
+/// Whether unaligned loads return the bytes at the address (ARMv6 with the U bit set) rather
+/// than the rotated aligned word of earlier cores
+static bool UnalignedAccessEnabled()
+{
+    FillPattern();
+    return LoadWord(pattern + 1) == PatternWord(1);
+}
+
+static bool TestUnalignedLoads()
+{
+    FillPattern();
+    for (u32 offset = 0; offset < 4; offset++) {
+        SoftAssert(LoadWord(pattern + 8 + offset) == PatternWord(8 + offset));
+        SoftAssert(LoadHalfword(pattern + 8 + offset) == PatternHalfword(8 + offset));
+        SoftAssert(LoadSignedHalfword(pattern + 8 + offset) == (s16)PatternHalfword(8 + offset));
+    }
+    return true;
+}
+
+static bool TestUnalignedStores()
+{
+    for (u32 offset = 0; offset < 4; offset++) {
+        FillPattern();
+        StoreWord(scratch + 8 + offset, 0xA1B2C3D4);
+        StoreHalfword(scratch + 24 + offset, 0xE5F6);
+        for (u32 i = 0; i < sizeof(scratch); i++) {
+            u8 expected = 0xEE;
+            if (i >= 8 + offset && i < 12 + offset)
+                expected = (u8)(0xA1B2C3D4 >> ((i - 8 - offset) * 8));
+            else if (i >= 24 + offset && i < 26 + offset)
+                expected = (u8)(0xE5F6 >> ((i - 24 - offset) * 8));
+            SoftAssert(scratch[i] == expected);
+        }
+    }
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Bytes and addressing modes
+
+static bool TestByteLanes()
+{
+    FillPattern();
+    for (u32 offset = 0; offset < 8; offset++) {
+        u32 value;
+        s32 signed_value;
+        asm volatile("ldrb %[value], [%[address]]\n"
+                     "ldrsb %[signed_value], [%[address]]\n"
+                     : [value] "=&r"(value), [signed_value] "=&r"(signed_value)
+                     : [address] "r"(pattern + offset) : "memory");
+        SoftAssert(value == pattern[offset]);
+        SoftAssert(signed_value == (s8)pattern[offset]);
+    }
+
+    for (u32 offset = 0; offset < 4; offset++) {
+        memset(scratch, 0xEE, sizeof(scratch));
+        asm volatile("strb %[value], [%[address]]"
+                     : : [address] "r"(scratch + 8 + offset), [value] "r"(0x12345678) : "memory");
+        for (u32 i = 0; i < 16; i++)
+            SoftAssert(scratch[i] == ((i == 8 + offset) ? 0x78 : 0xEE));
+    }
+    return true;
+}
+
+static bool TestWriteback()
+{
+    FillPattern();
+
+    // Post-indexed: the load uses the old base
+    const u8* base = pattern + 4;
+    u32 value;
+    asm volatile("ldrb %[value], [%[base]], #1" : [value] "=r"(value), [base] "+r"(base) : : "memory");
+    SoftAssert(value == pattern[4]);
+    SoftAssert(base == pattern + 5);
+
+    // Pre-indexed: the load uses the new base
+    base = pattern + 4;
+    asm volatile("ldr %[value], [%[base], #4]!" : [value] "=r"(value), [base] "+r"(base) : : "memory");
+    SoftAssert(value == PatternWord(8));
+    SoftAssert(base == pattern + 8);
+
+    // Negative register offset with writeback
+    base = pattern + 16;
+    asm volatile("ldrh %[value], [%[base], -%[offset]]!"
+                 : [value] "=r"(value), [base] "+r"(base) : [offset] "r"(6) : "memory");
+    SoftAssert(value == PatternHalfword(10));
+    SoftAssert(base == pattern + 10);
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Copy idioms. Each copies `size` bytes, a multiple of 32.
+
+typedef void (*CopyKernel)(u8* dst, const u8* src, u32 size);
+
+static void CopyBytes(u8* dst, const u8* src, u32 size)
+{
+    u32 value;
+    asm volatile("1: ldrb %[value], [%[src]], #1\n"
+                 "   strb %[value], [%[dst]], #1\n"
+                 "   subs %[size], %[size], #1\n"
+                 "   bne 1b\n"
+                 : [value] "=&r"(value), [dst] "+r"(dst), [src] "+r"(src), [size] "+r"(size)
+                 : : "cc", "memory");
+}
+
+static void CopyHalfwords(u8* dst, const u8* src, u32 size)
+{
+    u32 value;
+    asm volatile("1: ldrh %[value], [%[src]], #2\n"
+                 "   strh %[value], [%[dst]], #2\n"
+                 "   subs %[size], %[size], #2\n"
+                 "   bne 1b\n"
+                 : [value] "=&r"(value), [dst] "+r"(dst), [src] "+r"(src), [size] "+r"(size)
+                 : : "cc", "memory");
+}
+
+static void CopyWords(u8* dst, const u8* src, u32 size)
+{
+    u32 value;
+    asm volatile("1: ldr %[value], [%[src]], #4\n"
+                 "   str %[value], [%[dst]], #4\n"
+                 "   subs %[size], %[size], #4\n"
+                 "   bne 1b\n"
+                 : [value] "=&r"(value), [dst] "+r"(dst), [src] "+r"(src), [size] "+r"(size)
+                 : : "cc", "memory");
+}
+
+static void CopyDoublewords(u8* dst, const u8* src, u32 size)
+{
+    u64 value;
+    asm volatile("1: ldrd %[value], %H[value], [%[src]], #8\n"
+                 "   strd %[value], %H[value], [%[dst]], #8\n"
+                 "   subs %[size], %[size], #8\n"
+                 "   bne 1b\n"
+                 : [value] "=&r"(value), [dst] "+r"(dst), [src] "+r"(src), [size] "+r"(size)
+                 : : "cc", "memory");
+}
+
+static void CopyMultiple4(u8* dst, const u8* src, u32 size)
+{
+    asm volatile("1: ldmia %[src]!, {r4-r7}\n"
+                 "   stmia %[dst]!, {r4-r7}\n"
+                 "   subs %[size], %[size], #16\n"
+                 "   bne 1b\n"
+                 : [dst] "+r"(dst), [src] "+r"(src), [size] "+r"(size)
+                 : : "r4", "r5", "r6", "r7", "cc", "memory");
+}
+
+static void CopyMultiple8(u8* dst, const u8* src, u32 size)
+{
+    asm volatile("1: ldmia %[src]!, {r3-r10}\n"
+                 "   stmia %[dst]!, {r3-r10}\n"
+                 "   subs %[size], %[size], #32\n"
+                 "   bne 1b\n"
+                 : [dst] "+r"(dst), [src] "+r"(src), [size] "+r"(size)
+                 : : "r3", "r4", "r5", "r6", "r7", "r8", "r9", "r10", "cc", "memory");
+}
+
+static void CopyMemcpy(u8* dst, const u8* src, u32 size)
+{
+    memcpy(dst, src, size);
+}
+
+struct Alignment {
+    const char* name;
+    u32 src_offset;
+    u32 dst_offset;
+};
+
+static const Alignment ALIGNMENTS[] = {
+    { "aligned",       0, 0 },
+    { "src +4",        4, 0 },
+    { "src +1",        1, 0 },
+    { "src +1 dst +3", 1, 3 },
+};
+static const u32 NUM_ALIGNMENTS = sizeof(ALIGNMENTS) / sizeof(ALIGNMENTS[0]);
+
+enum {
+    NEEDS_WORD_ALIGNMENT = 1 << 0,   ///< LDM/STM and LDRD/STRD fault on anything less
+};
+
+struct CopyIdiom {
+    const char* name;
+    CopyKernel kernel;
+    u32 flags;
+};
+
+static const CopyIdiom COPY_IDIOMS[] = {
+    { "LDRB/STRB",       CopyBytes,       0 },
+    { "LDRH/STRH",       CopyHalfwords,   0 },
+    { "LDR/STR",         CopyWords,       0 },
+    { "LDRD/STRD",       CopyDoublewords, NEEDS_WORD_ALIGNMENT },
+    { "LDM/STM x4",      CopyMultiple4,   NEEDS_WORD_ALIGNMENT },
+    { "LDM/STM x8",      CopyMultiple8,   NEEDS_WORD_ALIGNMENT },
+    { "memcpy",          CopyMemcpy,      0 },
+};
+
+static u8 copy_src[COPY_SIZE + 32] __attribute__((aligned(32)));
+static u8 copy_dst[COPY_SIZE + 32] __attribute__((aligned(32)));
+
+static bool TestCopy(CopyKernel kernel, const Alignment& alignment)
+{
+    for (u32 i = 0; i < sizeof(copy_src); i++)
+        copy_src[i] = (u8)(i * 7 + (i >> 8));
+    memset(copy_dst, 0, sizeof(copy_dst));
+
+    kernel(copy_dst + alignment.dst_offset, copy_src + alignment.src_offset, COPY_SIZE);
+    SoftAssert(memcmp(copy_dst + alignment.dst_offset, copy_src + alignment.src_offset, COPY_SIZE) == 0);
+    // Nothing written around the copy
+    for (u32 i = 0; i < alignment.dst_offset; i++)
+        SoftAssert(copy_dst[i] == 0);
+    SoftAssert(copy_dst[alignment.dst_offset + COPY_SIZE] == 0);
+    return true;
+}
+
+/// Fastest of KERNEL_RUNS copies, in MiB/s
+static std::string CopySpeed(CopyKernel kernel, const Alignment& alignment)
+{
+    u64 ticks = Benchmark::BestTicks(KERNEL_RUNS, [&] {
+        kernel(copy_dst + alignment.dst_offset, copy_src + alignment.src_offset, COPY_SIZE);
+    });
+    return Common::FormatString("%.1f", Benchmark::MiBPerSecond(COPY_SIZE, ticks));
+}
+
+void TestAll()
+{
+    const std::string tag = "Memory";
+
+    bool unaligned = UnalignedAccessEnabled();
+    Log(GFX_TOP, Common::FormatString("Unaligned loads: %s\n", unaligned ? "enabled (U=1)" : "rotated (U=0)"));
+
+    for (const MultipleMode& mode : MULTIPLE_MODES) {
+        Test(tag, Common::FormatString("LDM%s writeback", mode.name), [&] { return TestLoadMultiple(mode); }, true);
+        Test(tag, Common::FormatString("STM%s writeback", mode.name), [&] { return TestStoreMultiple(mode); }, true);
+    }
+    Test(tag, "STM with the base first in the list", TestStoreMultipleBaseInList, true);
+    Test(tag, "LDRD/STRD", TestDoubleword, true);
+    Test(tag, "Unaligned LDR/LDRH/LDRSH", TestUnalignedLoads, true);
+    Test(tag, "Unaligned STR/STRH", TestUnalignedStores, true);
+    Test(tag, "LDRB/LDRSB/STRB byte lanes", TestByteLanes, true);
+    Test(tag, "Pre- and post-indexed writeback", TestWriteback, true);
+
+    static_assert(NUM_ALIGNMENTS == 4, "The table has a column per alignment");
+    Benchmark::Table table(Common::FormatString("Copy speed, %s blocks (MiB/s)", Benchmark::FormatSize(COPY_SIZE).c_str()),
+                           { "Idiom", ALIGNMENTS[0].name, ALIGNMENTS[1].name, ALIGNMENTS[2].name, ALIGNMENTS[3].name });
+    for (const CopyIdiom& idiom : COPY_IDIOMS) {
+        std::string cells[NUM_ALIGNMENTS];
+        for (u32 i = 0; i < NUM_ALIGNMENTS; i++) {
+            const Alignment& alignment = ALIGNMENTS[i];
+            bool word_aligned = (alignment.src_offset % 4) == 0 && (alignment.dst_offset % 4) == 0;
+            if ((idiom.flags & NEEDS_WORD_ALIGNMENT) && !word_aligned) {
+                cells[i] = "-";
+                continue;
+            }
+
+            std::string name = Common::FormatString("%s copy, %s", idiom.name, alignment.name);
+            if (Test(tag, name, [&] { return TestCopy(idiom.kernel, alignment); }, true))
+                cells[i] = CopySpeed(idiom.kernel, alignment);
+            else
+                cells[i] = "FAIL";
+        }
+        table.AddRow({ idiom.name, cells[0], cells[1], cells[2], cells[3] });
+    }
+    table.Log();
+}
+
+} // namespace
+} // namespace
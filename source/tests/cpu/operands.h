@@ -0,0 +1,38 @@
+#pragma once
+
+// Operand generation shared by the on-device sweeps and the host vector generator, so it is
+// kept free of 3DS headers.
+
+#include <cstdint>
+
+#include "common/random.h"
+
+namespace CPU {
+
+/// Values at the lane boundaries of bytes and halfwords, where saturation and carries happen
+static const uint32_t EDGE_OPERANDS[] = {
+    0x00000000, 0x00000001, 0x0000007F, 0x00000080, 0x000000FF,
+    0x00007FFF, 0x00008000, 0x0000FFFF, 0x7FFFFFFF, 0x80000000,
+    0xFFFFFFFF, 0x01010101, 0x7F7F7F7F, 0x80808080, 0xFEFEFEFE,
+    0x00FF00FF, 0xFF00FF00, 0x7FFF8000, 0x80007FFF, 0x55555555,
+    0xAAAAAAAA,
+};
+static const uint32_t NUM_EDGE_OPERANDS = sizeof(EDGE_OPERANDS) / sizeof(EDGE_OPERANDS[0]);
+
+/// Draws an operand, mixing uniformly random words with words built from edge-case bytes.
+inline uint32_t NextOperand(Common::XorShift32& rng)
+{
+    static const uint8_t EDGE_BYTES[8] = { 0x00, 0x01, 0x7E, 0x7F, 0x80, 0x81, 0xFE, 0xFF };
+
+    uint32_t bits = rng.Next();
+    // One in four operands is made of edge bytes, picked by the remaining bits
+    if ((bits & 3) != 0)
+        return rng.Next();
+
+    uint32_t operand = 0;
+    for (int i = 0; i < 4; i++)
+        operand |= (uint32_t)EDGE_BYTES[(bits >> (2 + i * 3)) & 7] << (i * 8);
+    return operand;
+}
+
+}
@@ -0,0 +1,27 @@
+#include "tests/cpu/sweep.h"
+
+#include "output.h"
+#include "common/string_funcs.h"
+
+namespace CPU {
+namespace Sweep {
+
+bool LogReport(const std::string& name, const Report& report)
+{
+    for (u32 i = 0; i < report.mismatches && i < MAX_RECORDED_MISMATCHES; i++) {
+        const Mismatch& m = report.recorded[i];
+        LogToFile(Common::FormatString("MISMATCH %s seed=%08X #%u: rn=%08X rm=%08X ra=%08X hw=%08X ref=%08X\n",
+                                       name.c_str(), (unsigned)report.seed, (unsigned)m.index,
+                                       (unsigned)m.rn, (unsigned)m.rm, (unsigned)m.ra,
+                                       (unsigned)m.hardware, (unsigned)m.reference));
+    }
+    if (report.mismatches > MAX_RECORDED_MISMATCHES) {
+        LogToFile(Common::FormatString("MISMATCH %s: %u more of %u\n", name.c_str(),
+                                       (unsigned)(report.mismatches - MAX_RECORDED_MISMATCHES),
+                                       (unsigned)report.count));
+    }
+    return report.mismatches == 0;
+}
+
+} // namespace
+} // namespace
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <string>
+
+#include <3ds.h>
+
+#include "common/random.h"
+#include "tests/cpu/operands.h"
+
+namespace CPU {
+namespace Sweep {
+
+/// Operands that gave a result different from the reference model
+struct Mismatch {
+    u32 index; ///< Position in the sweep, which together with the seed reproduces the operands
+    u32 rn, rm, ra;
+    u32 hardware;
+    u32 reference;
+};
+
+static const u32 MAX_RECORDED_MISMATCHES = 4;
+
+struct Report {
+    u32 seed;
+    u32 count;
+    u32 mismatches;
+    Mismatch recorded[MAX_RECORDED_MISMATCHES];
+};
+
+/**
+ * Runs `Op` over every pair of edge operands and then `random_count` random operand triples
+ * drawn from `seed`, comparing `Op::Hardware(rn, rm, ra)` against `Op::Reference(rn, rm, ra)`.
+ * Both are static members, so the instruction is inlined into the loop.
+ */
+template <typename Op>
+Report Run(u32 seed, u32 random_count)
+{
+    Report report = {};
+    report.seed = seed;
+
+    auto check = [&](u32 rn, u32 rm, u32 ra) {
+        u32 hardware = Op::Hardware(rn, rm, ra);
+        u32 reference = Op::Reference(rn, rm, ra);
+        if (hardware != reference) {
+            if (report.mismatches < MAX_RECORDED_MISMATCHES)
+                report.recorded[report.mismatches] = { report.count, rn, rm, ra, hardware, reference };
+            report.mismatches++;
+        }
+        report.count++;
+    };
+
+    for (u32 i = 0; i < NUM_EDGE_OPERANDS; i++)
+        for (u32 j = 0; j < NUM_EDGE_OPERANDS; j++)
+            check(EDGE_OPERANDS[i], EDGE_OPERANDS[j], EDGE_OPERANDS[(i + j) % NUM_EDGE_OPERANDS]);
+
+    Common::XorShift32 rng(seed);
+    for (u32 i = 0; i < random_count; i++) {
+        u32 rn = NextOperand(rng);
+        u32 rm = NextOperand(rng);
+        check(rn, rm, NextOperand(rng));
+    }
+
+    return report;
+}
+
+/// Logs one line per recorded mismatch of the sweep of `name`, and returns whether there were none.
+bool LogReport(const std::string& name, const Report& report);
+
+} // namespace
+} // namespace
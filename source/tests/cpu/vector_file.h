@@ -0,0 +1,38 @@
+#pragma once
+
+// Layout of CPU test vector files, written by tools/mkvectors.cpp and read by
+// tests/cpu/vector_reader.cpp. Kept free of 3DS headers so that the host tool shares it.
+//
+// A file is a VectorFileHeader followed by record_count VectorRecords, all little endian.
+
+#include <cstdint>
+
+namespace CPU {
+
+static const char VECTOR_FILE_MAGIC[4] = { 'H', 'W', 'T', 'V' };
+static const uint16_t VECTOR_FILE_VERSION = 1;
+
+struct VectorFileHeader {
+    char magic[4];
+    uint16_t version;
+    uint16_t record_size;   ///< sizeof(VectorRecord), so readers can reject mismatched files
+    uint32_t record_count;
+    uint32_t seed;          ///< Seed the random records were generated from, for reference
+};
+
+/// One instruction run: `opcode Rd, Rn, Rm` with the flags set to `flags_in` beforehand
+struct VectorRecord {
+    uint8_t opcode;         ///< Index into CPU_FLAG_OPS
+    uint8_t reserved;
+    uint16_t flags_in;      ///< CPSR bits 31:16 before the instruction
+    uint32_t rn;
+    uint32_t rm;
+    uint32_t rd;            ///< Expected result
+    uint16_t flags_out;     ///< Expected CPSR bits 31:16, of which CPSR_FLAGS_MASK is checked
+    uint16_t reserved2;
+};
+
+static_assert(sizeof(VectorFileHeader) == 16, "VectorFileHeader must match the file layout");
+static_assert(sizeof(VectorRecord) == 20, "VectorRecord must match the file layout");
+
+}
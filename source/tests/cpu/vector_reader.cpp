@@ -0,0 +1,48 @@
+#include "tests/cpu/vector_reader.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace CPU {
+
+VectorReader::VectorReader(const char* path, size_t chunk_records)
+    : file(nullptr), header(), chunk(chunk_records), remaining(0), truncated(false)
+{
+    FILE* f = fopen(path, "rb");
+    if (!f)
+        return;
+
+    if (fread(&header, sizeof(header), 1, f) != 1 ||
+        memcmp(header.magic, VECTOR_FILE_MAGIC, sizeof(header.magic)) != 0 ||
+        header.version != VECTOR_FILE_VERSION || header.record_size != sizeof(VectorRecord)) {
+        fclose(f);
+        return;
+    }
+
+    file = f;
+    remaining = header.record_count;
+}
+
+VectorReader::~VectorReader()
+{
+    if (file)
+        fclose(file);
+}
+
+size_t VectorReader::NextChunk()
+{
+    if (!file || remaining == 0)
+        return 0;
+
+    size_t wanted = std::min<size_t>(remaining, chunk.size());
+    size_t read = fread(chunk.data(), sizeof(VectorRecord), wanted, file);
+    if (read < wanted) {
+        truncated = true;
+        remaining = 0;
+    } else {
+        remaining -= read;
+    }
+    return read;
+}
+
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdio>
+#include <vector>
+
+#include <3ds.h>
+
+#include "tests/cpu/vector_file.h"
+
+namespace CPU {
+
+/**
+ * Reads a vector file in chunks of `chunk_records` records, so files far larger than the memory
+ * set aside for them can be run.
+ */
+class VectorReader {
+public:
+    static const size_t DEFAULT_CHUNK_RECORDS = 1024;
+
+    explicit VectorReader(const char* path, size_t chunk_records = DEFAULT_CHUNK_RECORDS);
+    ~VectorReader();
+
+    VectorReader(const VectorReader&) = delete;
+    VectorReader& operator=(const VectorReader&) = delete;
+
+    /// Returns whether the file exists and has a header this build understands.
+    bool IsOpen() const { return file != nullptr; }
+
+    const VectorFileHeader& Header() const { return header; }
+
+    /**
+     * Reads the next chunk and returns how many records it holds, or 0 once the file is
+     * exhausted. The records stay valid until the next call.
+     */
+    size_t NextChunk();
+    const VectorRecord* Records() const { return chunk.data(); }
+
+    /// Returns whether the file ended before all records promised by its header were read.
+    bool IsTruncated() const { return truncated; }
+
+private:
+    FILE* file;
+    VectorFileHeader header;
+    std::vector<VectorRecord> chunk;
+    u32 remaining;
+    bool truncated;
+};
+
+}
@@ -0,0 +1,82 @@
+#include <string>
+
+#include <3ds.h>
+
+#include "output.h"
+#include "common/string_funcs.h"
+#include "tests/test.h"
+#include "tests/cpu/cputests.h"
+#include "tests/cpu/flag_ops.h"
+#include "tests/cpu/vector_reader.h"
+
+namespace CPU {
+namespace Vectors {
+
+// Generated by tools/mkvectors.cpp and copied to the root of the SD card
+static const char* const VECTOR_FILE = "hwtest_vectors.bin";
+
+// Vector files can hold many millions of records
+static const u32 RUN_BUDGET_MS = 120000;
+// Mismatches logged per instruction; the rest are only counted
+static const u32 MAX_LOGGED_MISMATCHES = 4;
+
+struct OpResult {
+    u32 count;
+    u32 mismatches;
+};
+
+static bool RunVectors(VectorReader& reader, OpResult* results, u32* unknown)
+{
+    while (size_t count = reader.NextChunk()) {
+        const VectorRecord* records = reader.Records();
+        for (size_t i = 0; i < count; i++) {
+            const VectorRecord& record = records[i];
+            if (record.opcode >= NUM_FLAG_OPS) {
+                (*unknown)++;
+                continue;
+            }
+
+            u32 cpsr_in = ((u32)record.flags_in << 16) & CPSR_FLAGS_MASK;
+            Flags::Outcome expected = { record.rd, ((u32)record.flags_out << 16) & CPSR_FLAGS_MASK };
+            Flags::Outcome outcome = FlagOps::EXECUTORS[record.opcode](record.rn, record.rm, cpsr_in);
+
+            OpResult& result = results[record.opcode];
+            result.count++;
+            if (outcome != expected && result.mismatches++ < MAX_LOGGED_MISMATCHES) {
+                LogToFile(Common::FormatString("MISMATCH %s: rn=%08X rm=%08X cpsr=%08X hw=%08X/%08X ref=%08X/%08X\n",
+                                               FLAG_OP_MNEMONICS[record.opcode], (unsigned)record.rn,
+                                               (unsigned)record.rm, (unsigned)cpsr_in,
+                                               (unsigned)outcome.rd, (unsigned)outcome.cpsr,
+                                               (unsigned)expected.rd, (unsigned)expected.cpsr));
+            }
+        }
+    }
+    return !reader.IsTruncated();
+}
+
+void TestAll()
+{
+    const std::string tag = "Vectors";
+
+    VectorReader reader(VECTOR_FILE);
+    if (!reader.IsOpen()) {
+        Log(GFX_TOP, Common::FormatString("No usable %s on the SD card, skipping\n", VECTOR_FILE));
+        return;
+    }
+
+    OpResult results[NUM_FLAG_OPS] = {};
+    u32 unknown = 0;
+    Test(tag, "Reading vectors", [&] { return RunVectors(reader, results, &unknown); }, true, RUN_BUDGET_MS);
+
+    for (u32 op = 0; op < NUM_FLAG_OPS; op++) {
+        if (results[op].count != 0)
+            Test(tag, FLAG_OP_MNEMONICS[op], results[op].mismatches, (u32)0);
+    }
+
+    Log(GFX_TOP, Common::FormatString("%u vectors (seed %08X), %u with unknown opcodes\n",
+                                      (unsigned)reader.Header().record_count,
+                                      (unsigned)reader.Header().seed, (unsigned)unknown));
+}
+
+} // namespace
+} // namespace
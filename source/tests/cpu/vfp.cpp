@@ -0,0 +1,358 @@
+#include <string>
+
+#include <3ds.h>
+
+#include "output.h"
+#include "common/scope_exit.h"
+#include "common/string_funcs.h"
+#include "tests/benchmark.h"
+#include "tests/test.h"
+#include "tests/cpu/cputests.h"
+
+// Built with -fno-fast-math (see the Makefile), so the compiler keeps IEEE semantics here too.
+
+namespace CPU {
+namespace Vfp {
+
+// FPSCR fields
+static const u32 FPSCR_DN = 1 << 25;          ///< Default NaN
+static const u32 FPSCR_FZ = 1 << 24;          ///< Flush to zero
+static const u32 FPSCR_RMODE_SHIFT = 22;
+static const u32 FPSCR_IOC = 1 << 0;          ///< Invalid operation
+static const u32 FPSCR_DZC = 1 << 1;          ///< Division by zero
+static const u32 FPSCR_OFC = 1 << 2;          ///< Overflow
+static const u32 FPSCR_UFC = 1 << 3;          ///< Underflow
+static const u32 FPSCR_IXC = 1 << 4;          ///< Inexact
+static const u32 FPSCR_IDC = 1 << 7;          ///< Input denormal
+static const u32 FPSCR_CUMULATIVE_MASK = 0x9F;
+
+// The VFP11 only handles denormals and NaNs in hardware in RunFast mode (flush to zero, default
+// NaN, no trapped exceptions); otherwise it hands them to support code the 3DS may not have.
+// Every test runs in RunFast mode, and the reference results are generated for it.
+static const u32 FPSCR_RUNFAST = FPSCR_DN | FPSCR_FZ;
+
+// FPSCR rounding modes
+enum {
+    RN, ///< Round to nearest, ties to even
+    RP, ///< Round towards plus infinity
+    RM, ///< Round towards minus infinity
+    RZ, ///< Round towards zero
+};
+
+enum VfpOp {
+    OP_FADDS, OP_FSUBS, OP_FMULS, OP_FDIVS, OP_FSQRTS,
+    OP_FADDD, OP_FSUBD, OP_FMULD, OP_FDIVD, OP_FSQRTD,
+    OP_FTOSIS, OP_FTOSIZS, OP_FTOUIS, OP_FSITOS, OP_FCVTDS, OP_FCVTSD,
+    NUM_OPS,
+};
+
+static const char* const OP_NAMES[NUM_OPS] = {
+    "FADDS", "FSUBS", "FMULS", "FDIVS", "FSQRTS",
+    "FADDD", "FSUBD", "FMULD", "FDIVD", "FSQRTD",
+    "FTOSIS", "FTOSIZS", "FTOUIS", "FSITOS", "FCVTDS", "FCVTSD",
+};
+
+static const char* const ROUNDING_NAMES[] = { "RN", "RP", "RM", "RZ" };
+
+/// Operands and expected result as raw bits; single precision values use the low word
+struct VfpVector {
+    VfpOp op;
+    u32 rounding;
+    u64 a;
+    u64 b;
+    u64 expected;
+};
+
+#include "tests/cpu/vfp_vectors.h"
+
+static u32 GetFpscr()
+{
+    u32 fpscr;
+    asm volatile ("fmrx %[fpscr], fpscr" : [fpscr] "=r"(fpscr));
+    return fpscr;
+}
+
+static void SetFpscr(u32 fpscr)
+{
+    asm volatile ("fmxr fpscr, %[fpscr]" : : [fpscr] "r"(fpscr));
+}
+
+// Register use: single operands in s0 and s1, double operands in d1 and d2 (s2-s5), single
+// results in s6 and double results in d4 (s8-s9).
+
+#define SINGLE_OP(mnemonic) \
+    asm volatile ("fmsr s0, %[a]\n\t" \
+                  "fmsr s1, %[b]\n\t" \
+                  mnemonic "\n\t" \
+                  "fmrs %[result], s6" \
+                  : [result] "=r"(result) : [a] "r"(a), [b] "r"(b) \
+                  : "s0", "s1", "s6")
+
+#define DOUBLE_OP(mnemonic) \
+    asm volatile ("fmdrr d1, %[a_lo], %[a_hi]\n\t" \
+                  "fmdrr d2, %[b_lo], %[b_hi]\n\t" \
+                  mnemonic "\n\t" \
+                  "fmrrd %[lo], %[hi], d4" \
+                  : [lo] "=r"(lo), [hi] "=r"(hi) \
+                  : [a_lo] "r"(a_lo), [a_hi] "r"(a_hi), [b_lo] "r"(b_lo), [b_hi] "r"(b_hi) \
+                  : "s2", "s3", "s4", "s5", "s8", "s9")
+
+static u64 ExecuteSingle(VfpOp op, u32 a, u32 b)
+{
+    u32 result = 0;
+    switch (op) {
+    case OP_FADDS:   SINGLE_OP("fadds s6, s0, s1"); break;
+    case OP_FSUBS:   SINGLE_OP("fsubs s6, s0, s1"); break;
+    case OP_FMULS:   SINGLE_OP("fmuls s6, s0, s1"); break;
+    case OP_FDIVS:   SINGLE_OP("fdivs s6, s0, s1"); break;
+    case OP_FSQRTS:  SINGLE_OP("fsqrts s6, s0"); break;
+    case OP_FTOSIS:  SINGLE_OP("ftosis s6, s0"); break;
+    case OP_FTOSIZS: SINGLE_OP("ftosizs s6, s0"); break;
+    case OP_FTOUIS:  SINGLE_OP("ftouis s6, s0"); break;
+    case OP_FSITOS:  SINGLE_OP("fsitos s6, s0"); break;
+    default: break;
+    }
+    return result;
+}
+
+static u64 ExecuteDouble(VfpOp op, u64 a, u64 b)
+{
+    u32 a_lo = (u32)a, a_hi = (u32)(a >> 32);
+    u32 b_lo = (u32)b, b_hi = (u32)(b >> 32);
+    u32 lo = 0, hi = 0;
+    switch (op) {
+    case OP_FADDD:  DOUBLE_OP("faddd d4, d1, d2"); break;
+    case OP_FSUBD:  DOUBLE_OP("fsubd d4, d1, d2"); break;
+    case OP_FMULD:  DOUBLE_OP("fmuld d4, d1, d2"); break;
+    case OP_FDIVD:  DOUBLE_OP("fdivd d4, d1, d2"); break;
+    case OP_FSQRTD: DOUBLE_OP("fsqrtd d4, d1"); break;
+    default: break;
+    }
+    return ((u64)hi << 32) | lo;
+}
+
+#undef SINGLE_OP
+#undef DOUBLE_OP
+
+static u64 ExecuteWiden(u32 a)
+{
+    u32 lo, hi;
+    asm volatile ("fmsr s0, %[a]\n\t"
+                  "fcvtds d4, s0\n\t"
+                  "fmrrd %[lo], %[hi], d4"
+                  : [lo] "=r"(lo), [hi] "=r"(hi) : [a] "r"(a)
+                  : "s0", "s8", "s9");
+    return ((u64)hi << 32) | lo;
+}
+
+static u64 ExecuteNarrow(u64 a)
+{
+    u32 result;
+    asm volatile ("fmdrr d1, %[a_lo], %[a_hi]\n\t"
+                  "fcvtsd s6, d1\n\t"
+                  "fmrs %[result], s6"
+                  : [result] "=r"(result) : [a_lo] "r"((u32)a), [a_hi] "r"((u32)(a >> 32))
+                  : "s2", "s3", "s6");
+    return result;
+}
+
+static u64 Execute(VfpOp op, u64 a, u64 b)
+{
+    switch (op) {
+    case OP_FADDD: case OP_FSUBD: case OP_FMULD: case OP_FDIVD: case OP_FSQRTD:
+        return ExecuteDouble(op, a, b);
+    case OP_FCVTDS:
+        return ExecuteWiden((u32)a);
+    case OP_FCVTSD:
+        return ExecuteNarrow(a);
+    default:
+        return ExecuteSingle(op, (u32)a, (u32)b);
+    }
+}
+
+static bool TestVectors(VfpOp op)
+{
+    u32 saved_fpscr = GetFpscr();
+    SCOPE_EXIT({ SetFpscr(saved_fpscr); });
+
+    bool passed = true;
+    for (const VfpVector& vector : VFP_VECTORS) {
+        if (vector.op != op)
+            continue;
+
+        SetFpscr(FPSCR_RUNFAST | (vector.rounding << FPSCR_RMODE_SHIFT));
+        u64 result = Execute(op, vector.a, vector.b);
+        if (result != vector.expected) {
+            LogToFile(Common::FormatString("MISMATCH %s %s: a=%016llX b=%016llX got=%016llX expected=%016llX\n",
+                                           OP_NAMES[op], ROUNDING_NAMES[vector.rounding], vector.a,
+                                           vector.b, result, vector.expected));
+            passed = false;
+        }
+    }
+    return passed;
+}
+
+struct FlagCase {
+    const char* name;
+    VfpOp op;
+    u32 a;
+    u32 b;
+    u32 flag;
+};
+
+// Cumulative exception flags raised by single precision operations
+static const FlagCase FLAG_CASES[] = {
+    { "IOC on 0/0",         OP_FDIVS,  0x00000000, 0x00000000, FPSCR_IOC },
+    { "IOC on sNaN",        OP_FADDS,  0x7F800001, 0x3F800000, FPSCR_IOC },
+    { "IOC on NaN to int",  OP_FTOSIS, 0x7FC00000, 0,          FPSCR_IOC },
+    { "DZC on 1/0",         OP_FDIVS,  0x3F800000, 0x00000000, FPSCR_DZC },
+    { "OFC on MAX*MAX",     OP_FMULS,  0x7F7FFFFF, 0x7F7FFFFF, FPSCR_OFC },
+    { "UFC on flushed",     OP_FMULS,  0x00800000, 0x3F000000, FPSCR_UFC },
+    { "IXC on 1/3",         OP_FDIVS,  0x3F800000, 0x40400000, FPSCR_IXC },
+    { "IDC on denormal",    OP_FADDS,  0x00000001, 0x3F800000, FPSCR_IDC },
+};
+
+static bool TestFlag(const FlagCase& flag_case)
+{
+    u32 saved_fpscr = GetFpscr();
+    SCOPE_EXIT({ SetFpscr(saved_fpscr); });
+
+    SetFpscr(FPSCR_RUNFAST);
+    Execute(flag_case.op, flag_case.a, flag_case.b);
+    u32 flags = GetFpscr() & FPSCR_CUMULATIVE_MASK;
+    if (!(flags & flag_case.flag)) {
+        LogToFile(Common::FormatString("MISMATCH %s: cumulative flags %02X\n", flag_case.name, (unsigned)flags));
+        return false;
+    }
+    return true;
+}
+
+// Benchmark kernels. Each runs KERNEL_OPS operations after loading 1.0 into every register, so
+// the values never become special. Latency kernels chain every operation on the previous
+// result; throughput kernels rotate over independent destination registers.
+
+#define KERNEL_OPS 256
+
+#define SINGLE_SETUP \
+    "fmsr s0, %[one]\n\t"  "fmsr s1, %[one]\n\t"  "fmsr s2, %[one]\n\t"  "fmsr s3, %[one]\n\t" \
+    "fmsr s4, %[one]\n\t"  "fmsr s5, %[one]\n\t"  "fmsr s6, %[one]\n\t"  "fmsr s7, %[one]\n\t" \
+    "fmsr s8, %[one]\n\t"  "fmsr s9, %[one]\n\t"
+
+#define DOUBLE_SETUP \
+    "fmdrr d0, %[zero], %[one_hi]\n\t" "fmdrr d1, %[zero], %[one_hi]\n\t" \
+    "fmdrr d2, %[zero], %[one_hi]\n\t" "fmdrr d3, %[zero], %[one_hi]\n\t" \
+    "fmdrr d4, %[zero], %[one_hi]\n\t" "fmdrr d5, %[zero], %[one_hi]\n\t"
+
+#define VFP_KERNEL(name, setup, reps, body) \
+    static void name() \
+    { \
+        asm volatile (setup ".rept " #reps "\n\t" body "\n\t.endr" \
+                      : : [one] "r"(0x3F800000), [zero] "r"(0), [one_hi] "r"(0x3FF00000) \
+                      : "s0", "s1", "s2", "s3", "s4", "s5", "s6", "s7", "s8", "s9", "s10", "s11"); \
+    }
+
+#define SINGLE_THROUGHPUT(op) \
+    op " s0, s0, s8\n\t" op " s1, s1, s8\n\t" op " s2, s2, s8\n\t" op " s3, s3, s8\n\t" \
+    op " s4, s4, s8\n\t" op " s5, s5, s8\n\t" op " s6, s6, s8\n\t" op " s7, s7, s8"
+
+#define DOUBLE_THROUGHPUT(op) \
+    op " d0, d0, d4\n\t" op " d1, d1, d4\n\t" op " d2, d2, d4\n\t" op " d3, d3, d4"
+
+VFP_KERNEL(EmptySingle, SINGLE_SETUP, 1, "")
+VFP_KERNEL(EmptyDouble, DOUBLE_SETUP, 1, "")
+
+VFP_KERNEL(FaddsLatency,    SINGLE_SETUP, 256, "fadds s0, s0, s8")
+VFP_KERNEL(FaddsThroughput, SINGLE_SETUP, 32,  SINGLE_THROUGHPUT("fadds"))
+VFP_KERNEL(FmulsLatency,    SINGLE_SETUP, 256, "fmuls s0, s0, s8")
+VFP_KERNEL(FmulsThroughput, SINGLE_SETUP, 32,  SINGLE_THROUGHPUT("fmuls"))
+VFP_KERNEL(FmacsLatency,    SINGLE_SETUP, 256, "fmacs s0, s8, s9")
+VFP_KERNEL(FmacsThroughput, SINGLE_SETUP, 32,
+           "fmacs s0, s8, s9\n\t" "fmacs s1, s8, s9\n\t" "fmacs s2, s8, s9\n\t" "fmacs s3, s8, s9\n\t"
+           "fmacs s4, s8, s9\n\t" "fmacs s5, s8, s9\n\t" "fmacs s6, s8, s9\n\t" "fmacs s7, s8, s9")
+VFP_KERNEL(FdivsLatency,    SINGLE_SETUP, 256, "fdivs s0, s0, s8")
+VFP_KERNEL(FdivsThroughput, SINGLE_SETUP, 32,  SINGLE_THROUGHPUT("fdivs"))
+VFP_KERNEL(FsqrtsLatency,   SINGLE_SETUP, 256, "fsqrts s0, s0")
+VFP_KERNEL(FsqrtsThroughput, SINGLE_SETUP, 32,
+           "fsqrts s0, s8\n\t" "fsqrts s1, s8\n\t" "fsqrts s2, s8\n\t" "fsqrts s3, s8\n\t"
+           "fsqrts s4, s8\n\t" "fsqrts s5, s8\n\t" "fsqrts s6, s8\n\t" "fsqrts s7, s8")
+
+VFP_KERNEL(FadddLatency,    DOUBLE_SETUP, 256, "faddd d0, d0, d4")
+VFP_KERNEL(FadddThroughput, DOUBLE_SETUP, 64,  DOUBLE_THROUGHPUT("faddd"))
+VFP_KERNEL(FmuldLatency,    DOUBLE_SETUP, 256, "fmuld d0, d0, d4")
+VFP_KERNEL(FmuldThroughput, DOUBLE_SETUP, 64,  DOUBLE_THROUGHPUT("fmuld"))
+VFP_KERNEL(FmacdLatency,    DOUBLE_SETUP, 256, "fmacd d0, d4, d5")
+VFP_KERNEL(FmacdThroughput, DOUBLE_SETUP, 64,
+           "fmacd d0, d4, d5\n\t" "fmacd d1, d4, d5\n\t" "fmacd d2, d4, d5\n\t" "fmacd d3, d4, d5")
+VFP_KERNEL(FdivdLatency,    DOUBLE_SETUP, 256, "fdivd d0, d0, d4")
+VFP_KERNEL(FdivdThroughput, DOUBLE_SETUP, 64,  DOUBLE_THROUGHPUT("fdivd"))
+VFP_KERNEL(FsqrtdLatency,   DOUBLE_SETUP, 256, "fsqrtd d0, d0")
+VFP_KERNEL(FsqrtdThroughput, DOUBLE_SETUP, 64,
+           "fsqrtd d0, d4\n\t" "fsqrtd d1, d4\n\t" "fsqrtd d2, d4\n\t" "fsqrtd d3, d4")
+
+// Conversions alternate directions so each one consumes the previous result
+VFP_KERNEL(FtosisFsitosLatency, SINGLE_SETUP, 128, "ftosis s0, s0\n\tfsitos s0, s0")
+VFP_KERNEL(FsitosThroughput,    SINGLE_SETUP, 32,
+           "fsitos s0, s8\n\t" "fsitos s1, s8\n\t" "fsitos s2, s8\n\t" "fsitos s3, s8\n\t"
+           "fsitos s4, s8\n\t" "fsitos s5, s8\n\t" "fsitos s6, s8\n\t" "fsitos s7, s8")
+VFP_KERNEL(FcvtdsFcvtsdLatency, SINGLE_SETUP, 128, "fcvtds d2, s0\n\tfcvtsd s0, d2")
+VFP_KERNEL(FcvtdsThroughput,    SINGLE_SETUP, 64,
+           "fcvtds d1, s8\n\t" "fcvtds d2, s8\n\t" "fcvtds d3, s8\n\t" "fcvtds d5, s8")
+
+#undef VFP_KERNEL
+#undef SINGLE_SETUP
+#undef DOUBLE_SETUP
+#undef SINGLE_THROUGHPUT
+#undef DOUBLE_THROUGHPUT
+
+static const int KERNEL_RUNS = 32;
+
+/// Cycles per operation of `kernel`, without the setup and timing measured by `empty`
+static std::string CyclesPerOp(void (*kernel)(), void (*empty)())
+{
+    u64 ticks = Benchmark::BestTicks(KERNEL_RUNS, kernel);
+    u64 overhead = Benchmark::BestTicks(KERNEL_RUNS, empty);
+    u64 tenths = (ticks > overhead ? ticks - overhead : 0) * 10 / KERNEL_OPS;
+    return Common::FormatString("%llu.%llu", tenths / 10, tenths % 10);
+}
+
+void TestAll()
+{
+    const std::string tag = "VFP";
+
+    Log(GFX_TOP, Common::FormatString("FPSCR at thread start: %08X\n", (unsigned)GetFpscr()));
+
+    for (int op = 0; op < NUM_OPS; op++)
+        Test(tag, OP_NAMES[op], [&] { return TestVectors((VfpOp)op); }, true);
+
+    for (const FlagCase& flag_case : FLAG_CASES)
+        Test(tag, flag_case.name, [&] { return TestFlag(flag_case); }, true);
+
+    u32 saved_fpscr = GetFpscr();
+    SetFpscr(FPSCR_RUNFAST);
+
+    Benchmark::Table table("VFP cost (cycles per op)", { "Operation", "Latency", "Throughput" });
+    auto bench = [&](const char* name, void (*latency)(), void (*throughput)(), void (*empty)()) {
+        table.AddRow({ name, latency ? CyclesPerOp(latency, empty) : "-",
+                       throughput ? CyclesPerOp(throughput, empty) : "-" });
+    };
+    bench("FADDS",  FaddsLatency,  FaddsThroughput,  EmptySingle);
+    bench("FMULS",  FmulsLatency,  FmulsThroughput,  EmptySingle);
+    bench("FMACS",  FmacsLatency,  FmacsThroughput,  EmptySingle);
+    bench("FDIVS",  FdivsLatency,  FdivsThroughput,  EmptySingle);
+    bench("FSQRTS", FsqrtsLatency, FsqrtsThroughput, EmptySingle);
+    bench("FADDD",  FadddLatency,  FadddThroughput,  EmptyDouble);
+    bench("FMULD",  FmuldLatency,  FmuldThroughput,  EmptyDouble);
+    bench("FMACD",  FmacdLatency,  FmacdThroughput,  EmptyDouble);
+    bench("FDIVD",  FdivdLatency,  FdivdThroughput,  EmptyDouble);
+    bench("FSQRTD", FsqrtdLatency, FsqrtdThroughput, EmptyDouble);
+    bench("FTOSIS+FSITOS", FtosisFsitosLatency, nullptr, EmptySingle);
+    bench("FSITOS", nullptr, FsitosThroughput, EmptySingle);
+    bench("FCVTDS+FCVTSD", FcvtdsFcvtsdLatency, nullptr, EmptySingle);
+    bench("FCVTDS", nullptr, FcvtdsThroughput, EmptySingle);
+
+    SetFpscr(saved_fpscr);
+    table.Log();
+}
+
+} // namespace
+} // namespace
@@ -0,0 +1,639 @@
+// Generated by tools/vfp_reference.cpp. Do not edit.
+
+#pragma once
+
+static const VfpVector VFP_VECTORS[] = {
+    { OP_FADDS,  RN, 0x000000003F800000ULL, 0x0000000040400000ULL, 0x0000000040800000ULL },
+    { OP_FADDS,  RN, 0x00000000BF800000ULL, 0x0000000040400000ULL, 0x0000000040000000ULL },
+    { OP_FADDS,  RN, 0x0000000040000000ULL, 0x0000000040400000ULL, 0x0000000040A00000ULL },
+    { OP_FADDS,  RN, 0x000000003DCCCCCDULL, 0x000000003E4CCCCDULL, 0x000000003E99999AULL },
+    { OP_FADDS,  RN, 0x000000003F800000ULL, 0x0000000033800000ULL, 0x000000003F800000ULL },
+    { OP_FADDS,  RN, 0x000000003F800000ULL, 0x0000000033C00000ULL, 0x000000003F800001ULL },
+    { OP_FADDS,  RN, 0x000000007F7FFFFFULL, 0x000000007F7FFFFFULL, 0x000000007F800000ULL },
+    { OP_FADDS,  RN, 0x000000007149F2CAULL, 0x000000007149F2CAULL, 0x0000000071C9F2CAULL },
+    { OP_FADDS,  RN, 0x0000000080000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FADDS,  RN, 0x0000000000800000ULL, 0x000000003F000000ULL, 0x000000003F000000ULL },
+    { OP_FADDS,  RN, 0x0000000000000001ULL, 0x000000003F800000ULL, 0x000000003F800000ULL },
+    { OP_FADDS,  RN, 0x000000007F800000ULL, 0x00000000FF800000ULL, 0x000000007FC00000ULL },
+    { OP_FADDS,  RN, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FADDS,  RN, 0x000000003F800000ULL, 0x0000000000000000ULL, 0x000000003F800000ULL },
+    { OP_FADDS,  RN, 0x000000007FC12345ULL, 0x000000003F800000ULL, 0x000000007FC00000ULL },
+    { OP_FADDS,  RN, 0x000000007F800001ULL, 0x000000003F800000ULL, 0x000000007FC00000ULL },
+    { OP_FADDS,  RP, 0x000000003F800000ULL, 0x0000000040400000ULL, 0x0000000040800000ULL },
+    { OP_FADDS,  RP, 0x00000000BF800000ULL, 0x0000000040400000ULL, 0x0000000040000000ULL },
+    { OP_FADDS,  RP, 0x0000000040000000ULL, 0x0000000040400000ULL, 0x0000000040A00000ULL },
+    { OP_FADDS,  RP, 0x000000003DCCCCCDULL, 0x000000003E4CCCCDULL, 0x000000003E99999AULL },
+    { OP_FADDS,  RP, 0x000000003F800000ULL, 0x0000000033800000ULL, 0x000000003F800001ULL },
+    { OP_FADDS,  RP, 0x000000003F800000ULL, 0x0000000033C00000ULL, 0x000000003F800001ULL },
+    { OP_FADDS,  RP, 0x000000007F7FFFFFULL, 0x000000007F7FFFFFULL, 0x000000007F800000ULL },
+    { OP_FADDS,  RP, 0x000000007149F2CAULL, 0x000000007149F2CAULL, 0x0000000071C9F2CAULL },
+    { OP_FADDS,  RM, 0x000000003F800000ULL, 0x0000000040400000ULL, 0x0000000040800000ULL },
+    { OP_FADDS,  RM, 0x00000000BF800000ULL, 0x0000000040400000ULL, 0x0000000040000000ULL },
+    { OP_FADDS,  RM, 0x0000000040000000ULL, 0x0000000040400000ULL, 0x0000000040A00000ULL },
+    { OP_FADDS,  RM, 0x000000003DCCCCCDULL, 0x000000003E4CCCCDULL, 0x000000003E999999ULL },
+    { OP_FADDS,  RM, 0x000000003F800000ULL, 0x0000000033800000ULL, 0x000000003F800000ULL },
+    { OP_FADDS,  RM, 0x000000003F800000ULL, 0x0000000033C00000ULL, 0x000000003F800000ULL },
+    { OP_FADDS,  RM, 0x000000007F7FFFFFULL, 0x000000007F7FFFFFULL, 0x000000007F7FFFFFULL },
+    { OP_FADDS,  RM, 0x000000007149F2CAULL, 0x000000007149F2CAULL, 0x0000000071C9F2CAULL },
+    { OP_FADDS,  RZ, 0x000000003F800000ULL, 0x0000000040400000ULL, 0x0000000040800000ULL },
+    { OP_FADDS,  RZ, 0x00000000BF800000ULL, 0x0000000040400000ULL, 0x0000000040000000ULL },
+    { OP_FADDS,  RZ, 0x0000000040000000ULL, 0x0000000040400000ULL, 0x0000000040A00000ULL },
+    { OP_FADDS,  RZ, 0x000000003DCCCCCDULL, 0x000000003E4CCCCDULL, 0x000000003E999999ULL },
+    { OP_FADDS,  RZ, 0x000000003F800000ULL, 0x0000000033800000ULL, 0x000000003F800000ULL },
+    { OP_FADDS,  RZ, 0x000000003F800000ULL, 0x0000000033C00000ULL, 0x000000003F800000ULL },
+    { OP_FADDS,  RZ, 0x000000007F7FFFFFULL, 0x000000007F7FFFFFULL, 0x000000007F7FFFFFULL },
+    { OP_FADDS,  RZ, 0x000000007149F2CAULL, 0x000000007149F2CAULL, 0x0000000071C9F2CAULL },
+    { OP_FSUBS,  RN, 0x000000003F800000ULL, 0x0000000040400000ULL, 0x00000000C0000000ULL },
+    { OP_FSUBS,  RN, 0x00000000BF800000ULL, 0x0000000040400000ULL, 0x00000000C0800000ULL },
+    { OP_FSUBS,  RN, 0x0000000040000000ULL, 0x0000000040400000ULL, 0x00000000BF800000ULL },
+    { OP_FSUBS,  RN, 0x000000003DCCCCCDULL, 0x000000003E4CCCCDULL, 0x00000000BDCCCCCDULL },
+    { OP_FSUBS,  RN, 0x000000003F800000ULL, 0x0000000033800000ULL, 0x000000003F7FFFFFULL },
+    { OP_FSUBS,  RN, 0x000000003F800000ULL, 0x0000000033C00000ULL, 0x000000003F7FFFFEULL },
+    { OP_FSUBS,  RN, 0x000000007F7FFFFFULL, 0x000000007F7FFFFFULL, 0x0000000000000000ULL },
+    { OP_FSUBS,  RN, 0x000000007149F2CAULL, 0x000000007149F2CAULL, 0x0000000000000000ULL },
+    { OP_FSUBS,  RN, 0x0000000080000000ULL, 0x0000000000000000ULL, 0x0000000080000000ULL },
+    { OP_FSUBS,  RN, 0x0000000000800000ULL, 0x000000003F000000ULL, 0x00000000BF000000ULL },
+    { OP_FSUBS,  RN, 0x0000000000000001ULL, 0x000000003F800000ULL, 0x00000000BF800000ULL },
+    { OP_FSUBS,  RN, 0x000000007F800000ULL, 0x00000000FF800000ULL, 0x000000007F800000ULL },
+    { OP_FSUBS,  RN, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FSUBS,  RN, 0x000000003F800000ULL, 0x0000000000000000ULL, 0x000000003F800000ULL },
+    { OP_FSUBS,  RN, 0x000000007FC12345ULL, 0x000000003F800000ULL, 0x000000007FC00000ULL },
+    { OP_FSUBS,  RN, 0x000000007F800001ULL, 0x000000003F800000ULL, 0x000000007FC00000ULL },
+    { OP_FSUBS,  RP, 0x000000003F800000ULL, 0x0000000040400000ULL, 0x00000000C0000000ULL },
+    { OP_FSUBS,  RP, 0x00000000BF800000ULL, 0x0000000040400000ULL, 0x00000000C0800000ULL },
+    { OP_FSUBS,  RP, 0x0000000040000000ULL, 0x0000000040400000ULL, 0x00000000BF800000ULL },
+    { OP_FSUBS,  RP, 0x000000003DCCCCCDULL, 0x000000003E4CCCCDULL, 0x00000000BDCCCCCDULL },
+    { OP_FSUBS,  RP, 0x000000003F800000ULL, 0x0000000033800000ULL, 0x000000003F7FFFFFULL },
+    { OP_FSUBS,  RP, 0x000000003F800000ULL, 0x0000000033C00000ULL, 0x000000003F7FFFFFULL },
+    { OP_FSUBS,  RP, 0x000000007F7FFFFFULL, 0x000000007F7FFFFFULL, 0x0000000000000000ULL },
+    { OP_FSUBS,  RP, 0x000000007149F2CAULL, 0x000000007149F2CAULL, 0x0000000000000000ULL },
+    { OP_FSUBS,  RM, 0x000000003F800000ULL, 0x0000000040400000ULL, 0x00000000C0000000ULL },
+    { OP_FSUBS,  RM, 0x00000000BF800000ULL, 0x0000000040400000ULL, 0x00000000C0800000ULL },
+    { OP_FSUBS,  RM, 0x0000000040000000ULL, 0x0000000040400000ULL, 0x00000000BF800000ULL },
+    { OP_FSUBS,  RM, 0x000000003DCCCCCDULL, 0x000000003E4CCCCDULL, 0x00000000BDCCCCCDULL },
+    { OP_FSUBS,  RM, 0x000000003F800000ULL, 0x0000000033800000ULL, 0x000000003F7FFFFFULL },
+    { OP_FSUBS,  RM, 0x000000003F800000ULL, 0x0000000033C00000ULL, 0x000000003F7FFFFEULL },
+    { OP_FSUBS,  RM, 0x000000007F7FFFFFULL, 0x000000007F7FFFFFULL, 0x0000000080000000ULL },
+    { OP_FSUBS,  RM, 0x000000007149F2CAULL, 0x000000007149F2CAULL, 0x0000000080000000ULL },
+    { OP_FSUBS,  RZ, 0x000000003F800000ULL, 0x0000000040400000ULL, 0x00000000C0000000ULL },
+    { OP_FSUBS,  RZ, 0x00000000BF800000ULL, 0x0000000040400000ULL, 0x00000000C0800000ULL },
+    { OP_FSUBS,  RZ, 0x0000000040000000ULL, 0x0000000040400000ULL, 0x00000000BF800000ULL },
+    { OP_FSUBS,  RZ, 0x000000003DCCCCCDULL, 0x000000003E4CCCCDULL, 0x00000000BDCCCCCDULL },
+    { OP_FSUBS,  RZ, 0x000000003F800000ULL, 0x0000000033800000ULL, 0x000000003F7FFFFFULL },
+    { OP_FSUBS,  RZ, 0x000000003F800000ULL, 0x0000000033C00000ULL, 0x000000003F7FFFFEULL },
+    { OP_FSUBS,  RZ, 0x000000007F7FFFFFULL, 0x000000007F7FFFFFULL, 0x0000000000000000ULL },
+    { OP_FSUBS,  RZ, 0x000000007149F2CAULL, 0x000000007149F2CAULL, 0x0000000000000000ULL },
+    { OP_FMULS,  RN, 0x000000003F800000ULL, 0x0000000040400000ULL, 0x0000000040400000ULL },
+    { OP_FMULS,  RN, 0x00000000BF800000ULL, 0x0000000040400000ULL, 0x00000000C0400000ULL },
+    { OP_FMULS,  RN, 0x0000000040000000ULL, 0x0000000040400000ULL, 0x0000000040C00000ULL },
+    { OP_FMULS,  RN, 0x000000003DCCCCCDULL, 0x000000003E4CCCCDULL, 0x000000003CA3D70BULL },
+    { OP_FMULS,  RN, 0x000000003F800000ULL, 0x0000000033800000ULL, 0x0000000033800000ULL },
+    { OP_FMULS,  RN, 0x000000003F800000ULL, 0x0000000033C00000ULL, 0x0000000033C00000ULL },
+    { OP_FMULS,  RN, 0x000000007F7FFFFFULL, 0x000000007F7FFFFFULL, 0x000000007F800000ULL },
+    { OP_FMULS,  RN, 0x000000007149F2CAULL, 0x000000007149F2CAULL, 0x000000007F800000ULL },
+    { OP_FMULS,  RN, 0x0000000080000000ULL, 0x0000000000000000ULL, 0x0000000080000000ULL },
+    { OP_FMULS,  RN, 0x0000000000800000ULL, 0x000000003F000000ULL, 0x0000000000000000ULL },
+    { OP_FMULS,  RN, 0x0000000000000001ULL, 0x000000003F800000ULL, 0x0000000000000000ULL },
+    { OP_FMULS,  RN, 0x000000007F800000ULL, 0x00000000FF800000ULL, 0x00000000FF800000ULL },
+    { OP_FMULS,  RN, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FMULS,  RN, 0x000000003F800000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FMULS,  RN, 0x000000007FC12345ULL, 0x000000003F800000ULL, 0x000000007FC00000ULL },
+    { OP_FMULS,  RN, 0x000000007F800001ULL, 0x000000003F800000ULL, 0x000000007FC00000ULL },
+    { OP_FMULS,  RP, 0x000000003F800000ULL, 0x0000000040400000ULL, 0x0000000040400000ULL },
+    { OP_FMULS,  RP, 0x00000000BF800000ULL, 0x0000000040400000ULL, 0x00000000C0400000ULL },
+    { OP_FMULS,  RP, 0x0000000040000000ULL, 0x0000000040400000ULL, 0x0000000040C00000ULL },
+    { OP_FMULS,  RP, 0x000000003DCCCCCDULL, 0x000000003E4CCCCDULL, 0x000000003CA3D70BULL },
+    { OP_FMULS,  RP, 0x000000003F800000ULL, 0x0000000033800000ULL, 0x0000000033800000ULL },
+    { OP_FMULS,  RP, 0x000000003F800000ULL, 0x0000000033C00000ULL, 0x0000000033C00000ULL },
+    { OP_FMULS,  RP, 0x000000007F7FFFFFULL, 0x000000007F7FFFFFULL, 0x000000007F800000ULL },
+    { OP_FMULS,  RP, 0x000000007149F2CAULL, 0x000000007149F2CAULL, 0x000000007F800000ULL },
+    { OP_FMULS,  RM, 0x000000003F800000ULL, 0x0000000040400000ULL, 0x0000000040400000ULL },
+    { OP_FMULS,  RM, 0x00000000BF800000ULL, 0x0000000040400000ULL, 0x00000000C0400000ULL },
+    { OP_FMULS,  RM, 0x0000000040000000ULL, 0x0000000040400000ULL, 0x0000000040C00000ULL },
+    { OP_FMULS,  RM, 0x000000003DCCCCCDULL, 0x000000003E4CCCCDULL, 0x000000003CA3D70AULL },
+    { OP_FMULS,  RM, 0x000000003F800000ULL, 0x0000000033800000ULL, 0x0000000033800000ULL },
+    { OP_FMULS,  RM, 0x000000003F800000ULL, 0x0000000033C00000ULL, 0x0000000033C00000ULL },
+    { OP_FMULS,  RM, 0x000000007F7FFFFFULL, 0x000000007F7FFFFFULL, 0x000000007F7FFFFFULL },
+    { OP_FMULS,  RM, 0x000000007149F2CAULL, 0x000000007149F2CAULL, 0x000000007F7FFFFFULL },
+    { OP_FMULS,  RZ, 0x000000003F800000ULL, 0x0000000040400000ULL, 0x0000000040400000ULL },
+    { OP_FMULS,  RZ, 0x00000000BF800000ULL, 0x0000000040400000ULL, 0x00000000C0400000ULL },
+    { OP_FMULS,  RZ, 0x0000000040000000ULL, 0x0000000040400000ULL, 0x0000000040C00000ULL },
+    { OP_FMULS,  RZ, 0x000000003DCCCCCDULL, 0x000000003E4CCCCDULL, 0x000000003CA3D70AULL },
+    { OP_FMULS,  RZ, 0x000000003F800000ULL, 0x0000000033800000ULL, 0x0000000033800000ULL },
+    { OP_FMULS,  RZ, 0x000000003F800000ULL, 0x0000000033C00000ULL, 0x0000000033C00000ULL },
+    { OP_FMULS,  RZ, 0x000000007F7FFFFFULL, 0x000000007F7FFFFFULL, 0x000000007F7FFFFFULL },
+    { OP_FMULS,  RZ, 0x000000007149F2CAULL, 0x000000007149F2CAULL, 0x000000007F7FFFFFULL },
+    { OP_FDIVS,  RN, 0x000000003F800000ULL, 0x0000000040400000ULL, 0x000000003EAAAAABULL },
+    { OP_FDIVS,  RN, 0x00000000BF800000ULL, 0x0000000040400000ULL, 0x00000000BEAAAAABULL },
+    { OP_FDIVS,  RN, 0x0000000040000000ULL, 0x0000000040400000ULL, 0x000000003F2AAAABULL },
+    { OP_FDIVS,  RN, 0x000000003DCCCCCDULL, 0x000000003E4CCCCDULL, 0x000000003F000000ULL },
+    { OP_FDIVS,  RN, 0x000000003F800000ULL, 0x0000000033800000ULL, 0x000000004B800000ULL },
+    { OP_FDIVS,  RN, 0x000000003F800000ULL, 0x0000000033C00000ULL, 0x000000004B2AAAABULL },
+    { OP_FDIVS,  RN, 0x000000007F7FFFFFULL, 0x000000007F7FFFFFULL, 0x000000003F800000ULL },
+    { OP_FDIVS,  RN, 0x000000007149F2CAULL, 0x000000007149F2CAULL, 0x000000003F800000ULL },
+    { OP_FDIVS,  RN, 0x0000000080000000ULL, 0x0000000000000000ULL, 0x000000007FC00000ULL },
+    { OP_FDIVS,  RN, 0x0000000000800000ULL, 0x000000003F000000ULL, 0x0000000001000000ULL },
+    { OP_FDIVS,  RN, 0x0000000000000001ULL, 0x000000003F800000ULL, 0x0000000000000000ULL },
+    { OP_FDIVS,  RN, 0x000000007F800000ULL, 0x00000000FF800000ULL, 0x000000007FC00000ULL },
+    { OP_FDIVS,  RN, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000007FC00000ULL },
+    { OP_FDIVS,  RN, 0x000000003F800000ULL, 0x0000000000000000ULL, 0x000000007F800000ULL },
+    { OP_FDIVS,  RN, 0x000000007FC12345ULL, 0x000000003F800000ULL, 0x000000007FC00000ULL },
+    { OP_FDIVS,  RN, 0x000000007F800001ULL, 0x000000003F800000ULL, 0x000000007FC00000ULL },
+    { OP_FDIVS,  RP, 0x000000003F800000ULL, 0x0000000040400000ULL, 0x000000003EAAAAABULL },
+    { OP_FDIVS,  RP, 0x00000000BF800000ULL, 0x0000000040400000ULL, 0x00000000BEAAAAAAULL },
+    { OP_FDIVS,  RP, 0x0000000040000000ULL, 0x0000000040400000ULL, 0x000000003F2AAAABULL },
+    { OP_FDIVS,  RP, 0x000000003DCCCCCDULL, 0x000000003E4CCCCDULL, 0x000000003F000000ULL },
+    { OP_FDIVS,  RP, 0x000000003F800000ULL, 0x0000000033800000ULL, 0x000000004B800000ULL },
+    { OP_FDIVS,  RP, 0x000000003F800000ULL, 0x0000000033C00000ULL, 0x000000004B2AAAABULL },
+    { OP_FDIVS,  RP, 0x000000007F7FFFFFULL, 0x000000007F7FFFFFULL, 0x000000003F800000ULL },
+    { OP_FDIVS,  RP, 0x000000007149F2CAULL, 0x000000007149F2CAULL, 0x000000003F800000ULL },
+    { OP_FDIVS,  RM, 0x000000003F800000ULL, 0x0000000040400000ULL, 0x000000003EAAAAAAULL },
+    { OP_FDIVS,  RM, 0x00000000BF800000ULL, 0x0000000040400000ULL, 0x00000000BEAAAAABULL },
+    { OP_FDIVS,  RM, 0x0000000040000000ULL, 0x0000000040400000ULL, 0x000000003F2AAAAAULL },
+    { OP_FDIVS,  RM, 0x000000003DCCCCCDULL, 0x000000003E4CCCCDULL, 0x000000003F000000ULL },
+    { OP_FDIVS,  RM, 0x000000003F800000ULL, 0x0000000033800000ULL, 0x000000004B800000ULL },
+    { OP_FDIVS,  RM, 0x000000003F800000ULL, 0x0000000033C00000ULL, 0x000000004B2AAAAAULL },
+    { OP_FDIVS,  RM, 0x000000007F7FFFFFULL, 0x000000007F7FFFFFULL, 0x000000003F800000ULL },
+    { OP_FDIVS,  RM, 0x000000007149F2CAULL, 0x000000007149F2CAULL, 0x000000003F800000ULL },
+    { OP_FDIVS,  RZ, 0x000000003F800000ULL, 0x0000000040400000ULL, 0x000000003EAAAAAAULL },
+    { OP_FDIVS,  RZ, 0x00000000BF800000ULL, 0x0000000040400000ULL, 0x00000000BEAAAAAAULL },
+    { OP_FDIVS,  RZ, 0x0000000040000000ULL, 0x0000000040400000ULL, 0x000000003F2AAAAAULL },
+    { OP_FDIVS,  RZ, 0x000000003DCCCCCDULL, 0x000000003E4CCCCDULL, 0x000000003F000000ULL },
+    { OP_FDIVS,  RZ, 0x000000003F800000ULL, 0x0000000033800000ULL, 0x000000004B800000ULL },
+    { OP_FDIVS,  RZ, 0x000000003F800000ULL, 0x0000000033C00000ULL, 0x000000004B2AAAAAULL },
+    { OP_FDIVS,  RZ, 0x000000007F7FFFFFULL, 0x000000007F7FFFFFULL, 0x000000003F800000ULL },
+    { OP_FDIVS,  RZ, 0x000000007149F2CAULL, 0x000000007149F2CAULL, 0x000000003F800000ULL },
+    { OP_FSQRTS, RN, 0x000000003F800000ULL, 0x0000000000000000ULL, 0x000000003F800000ULL },
+    { OP_FSQRTS, RN, 0x00000000BF800000ULL, 0x0000000000000000ULL, 0x000000007FC00000ULL },
+    { OP_FSQRTS, RN, 0x0000000040000000ULL, 0x0000000000000000ULL, 0x000000003FB504F3ULL },
+    { OP_FSQRTS, RN, 0x000000003DCCCCCDULL, 0x0000000000000000ULL, 0x000000003EA1E89BULL },
+    { OP_FSQRTS, RN, 0x000000007F7FFFFFULL, 0x0000000000000000ULL, 0x000000005F7FFFFFULL },
+    { OP_FSQRTS, RN, 0x000000007149F2CAULL, 0x0000000000000000ULL, 0x0000000058635FA9ULL },
+    { OP_FSQRTS, RN, 0x0000000080000000ULL, 0x0000000000000000ULL, 0x0000000080000000ULL },
+    { OP_FSQRTS, RN, 0x0000000000800000ULL, 0x0000000000000000ULL, 0x0000000020000000ULL },
+    { OP_FSQRTS, RN, 0x0000000000000001ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FSQRTS, RN, 0x000000007F800000ULL, 0x0000000000000000ULL, 0x000000007F800000ULL },
+    { OP_FSQRTS, RN, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FSQRTS, RN, 0x000000007FC12345ULL, 0x0000000000000000ULL, 0x000000007FC00000ULL },
+    { OP_FSQRTS, RN, 0x000000007F800001ULL, 0x0000000000000000ULL, 0x000000007FC00000ULL },
+    { OP_FSQRTS, RP, 0x000000003F800000ULL, 0x0000000000000000ULL, 0x000000003F800000ULL },
+    { OP_FSQRTS, RP, 0x00000000BF800000ULL, 0x0000000000000000ULL, 0x000000007FC00000ULL },
+    { OP_FSQRTS, RP, 0x0000000040000000ULL, 0x0000000000000000ULL, 0x000000003FB504F4ULL },
+    { OP_FSQRTS, RP, 0x000000003DCCCCCDULL, 0x0000000000000000ULL, 0x000000003EA1E89CULL },
+    { OP_FSQRTS, RP, 0x000000007F7FFFFFULL, 0x0000000000000000ULL, 0x000000005F800000ULL },
+    { OP_FSQRTS, RP, 0x000000007149F2CAULL, 0x0000000000000000ULL, 0x0000000058635FAAULL },
+    { OP_FSQRTS, RM, 0x000000003F800000ULL, 0x0000000000000000ULL, 0x000000003F800000ULL },
+    { OP_FSQRTS, RM, 0x00000000BF800000ULL, 0x0000000000000000ULL, 0x000000007FC00000ULL },
+    { OP_FSQRTS, RM, 0x0000000040000000ULL, 0x0000000000000000ULL, 0x000000003FB504F3ULL },
+    { OP_FSQRTS, RM, 0x000000003DCCCCCDULL, 0x0000000000000000ULL, 0x000000003EA1E89BULL },
+    { OP_FSQRTS, RM, 0x000000007F7FFFFFULL, 0x0000000000000000ULL, 0x000000005F7FFFFFULL },
+    { OP_FSQRTS, RM, 0x000000007149F2CAULL, 0x0000000000000000ULL, 0x0000000058635FA9ULL },
+    { OP_FSQRTS, RZ, 0x000000003F800000ULL, 0x0000000000000000ULL, 0x000000003F800000ULL },
+    { OP_FSQRTS, RZ, 0x00000000BF800000ULL, 0x0000000000000000ULL, 0x000000007FC00000ULL },
+    { OP_FSQRTS, RZ, 0x0000000040000000ULL, 0x0000000000000000ULL, 0x000000003FB504F3ULL },
+    { OP_FSQRTS, RZ, 0x000000003DCCCCCDULL, 0x0000000000000000ULL, 0x000000003EA1E89BULL },
+    { OP_FSQRTS, RZ, 0x000000007F7FFFFFULL, 0x0000000000000000ULL, 0x000000005F7FFFFFULL },
+    { OP_FSQRTS, RZ, 0x000000007149F2CAULL, 0x0000000000000000ULL, 0x0000000058635FA9ULL },
+    { OP_FADDD,  RN, 0x3FF0000000000000ULL, 0x4008000000000000ULL, 0x4010000000000000ULL },
+    { OP_FADDD,  RN, 0xBFF0000000000000ULL, 0x4008000000000000ULL, 0x4000000000000000ULL },
+    { OP_FADDD,  RN, 0x4000000000000000ULL, 0x4008000000000000ULL, 0x4014000000000000ULL },
+    { OP_FADDD,  RN, 0x3FB999999999999AULL, 0x3FC999999999999AULL, 0x3FD3333333333334ULL },
+    { OP_FADDD,  RN, 0x3FF0000000000000ULL, 0x3CA0000000000000ULL, 0x3FF0000000000000ULL },
+    { OP_FADDD,  RN, 0x3FF0000000000000ULL, 0x3CA8000000000000ULL, 0x3FF0000000000001ULL },
+    { OP_FADDD,  RN, 0x7FEFFFFFFFFFFFFFULL, 0x7FEFFFFFFFFFFFFFULL, 0x7FF0000000000000ULL },
+    { OP_FADDD,  RN, 0x7E37E43C8800759CULL, 0x7E37E43C8800759CULL, 0x7E47E43C8800759CULL },
+    { OP_FADDD,  RN, 0x8000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FADDD,  RN, 0x0010000000000000ULL, 0x3FE0000000000000ULL, 0x3FE0000000000000ULL },
+    { OP_FADDD,  RN, 0x0000000000000001ULL, 0x3FF0000000000000ULL, 0x3FF0000000000000ULL },
+    { OP_FADDD,  RN, 0x7FF0000000000000ULL, 0xFFF0000000000000ULL, 0x7FF8000000000000ULL },
+    { OP_FADDD,  RN, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FADDD,  RN, 0x3FF0000000000000ULL, 0x0000000000000000ULL, 0x3FF0000000000000ULL },
+    { OP_FADDD,  RN, 0x7FF8000012345678ULL, 0x3FF0000000000000ULL, 0x7FF8000000000000ULL },
+    { OP_FADDD,  RN, 0x7FF0000000000001ULL, 0x3FF0000000000000ULL, 0x7FF8000000000000ULL },
+    { OP_FADDD,  RP, 0x3FF0000000000000ULL, 0x4008000000000000ULL, 0x4010000000000000ULL },
+    { OP_FADDD,  RP, 0xBFF0000000000000ULL, 0x4008000000000000ULL, 0x4000000000000000ULL },
+    { OP_FADDD,  RP, 0x4000000000000000ULL, 0x4008000000000000ULL, 0x4014000000000000ULL },
+    { OP_FADDD,  RP, 0x3FB999999999999AULL, 0x3FC999999999999AULL, 0x3FD3333333333334ULL },
+    { OP_FADDD,  RP, 0x3FF0000000000000ULL, 0x3CA0000000000000ULL, 0x3FF0000000000001ULL },
+    { OP_FADDD,  RP, 0x3FF0000000000000ULL, 0x3CA8000000000000ULL, 0x3FF0000000000001ULL },
+    { OP_FADDD,  RP, 0x7FEFFFFFFFFFFFFFULL, 0x7FEFFFFFFFFFFFFFULL, 0x7FF0000000000000ULL },
+    { OP_FADDD,  RP, 0x7E37E43C8800759CULL, 0x7E37E43C8800759CULL, 0x7E47E43C8800759CULL },
+    { OP_FADDD,  RM, 0x3FF0000000000000ULL, 0x4008000000000000ULL, 0x4010000000000000ULL },
+    { OP_FADDD,  RM, 0xBFF0000000000000ULL, 0x4008000000000000ULL, 0x4000000000000000ULL },
+    { OP_FADDD,  RM, 0x4000000000000000ULL, 0x4008000000000000ULL, 0x4014000000000000ULL },
+    { OP_FADDD,  RM, 0x3FB999999999999AULL, 0x3FC999999999999AULL, 0x3FD3333333333333ULL },
+    { OP_FADDD,  RM, 0x3FF0000000000000ULL, 0x3CA0000000000000ULL, 0x3FF0000000000000ULL },
+    { OP_FADDD,  RM, 0x3FF0000000000000ULL, 0x3CA8000000000000ULL, 0x3FF0000000000000ULL },
+    { OP_FADDD,  RM, 0x7FEFFFFFFFFFFFFFULL, 0x7FEFFFFFFFFFFFFFULL, 0x7FEFFFFFFFFFFFFFULL },
+    { OP_FADDD,  RM, 0x7E37E43C8800759CULL, 0x7E37E43C8800759CULL, 0x7E47E43C8800759CULL },
+    { OP_FADDD,  RZ, 0x3FF0000000000000ULL, 0x4008000000000000ULL, 0x4010000000000000ULL },
+    { OP_FADDD,  RZ, 0xBFF0000000000000ULL, 0x4008000000000000ULL, 0x4000000000000000ULL },
+    { OP_FADDD,  RZ, 0x4000000000000000ULL, 0x4008000000000000ULL, 0x4014000000000000ULL },
+    { OP_FADDD,  RZ, 0x3FB999999999999AULL, 0x3FC999999999999AULL, 0x3FD3333333333333ULL },
+    { OP_FADDD,  RZ, 0x3FF0000000000000ULL, 0x3CA0000000000000ULL, 0x3FF0000000000000ULL },
+    { OP_FADDD,  RZ, 0x3FF0000000000000ULL, 0x3CA8000000000000ULL, 0x3FF0000000000000ULL },
+    { OP_FADDD,  RZ, 0x7FEFFFFFFFFFFFFFULL, 0x7FEFFFFFFFFFFFFFULL, 0x7FEFFFFFFFFFFFFFULL },
+    { OP_FADDD,  RZ, 0x7E37E43C8800759CULL, 0x7E37E43C8800759CULL, 0x7E47E43C8800759CULL },
+    { OP_FSUBD,  RN, 0x3FF0000000000000ULL, 0x4008000000000000ULL, 0xC000000000000000ULL },
+    { OP_FSUBD,  RN, 0xBFF0000000000000ULL, 0x4008000000000000ULL, 0xC010000000000000ULL },
+    { OP_FSUBD,  RN, 0x4000000000000000ULL, 0x4008000000000000ULL, 0xBFF0000000000000ULL },
+    { OP_FSUBD,  RN, 0x3FB999999999999AULL, 0x3FC999999999999AULL, 0xBFB999999999999AULL },
+    { OP_FSUBD,  RN, 0x3FF0000000000000ULL, 0x3CA0000000000000ULL, 0x3FEFFFFFFFFFFFFFULL },
+    { OP_FSUBD,  RN, 0x3FF0000000000000ULL, 0x3CA8000000000000ULL, 0x3FEFFFFFFFFFFFFEULL },
+    { OP_FSUBD,  RN, 0x7FEFFFFFFFFFFFFFULL, 0x7FEFFFFFFFFFFFFFULL, 0x0000000000000000ULL },
+    { OP_FSUBD,  RN, 0x7E37E43C8800759CULL, 0x7E37E43C8800759CULL, 0x0000000000000000ULL },
+    { OP_FSUBD,  RN, 0x8000000000000000ULL, 0x0000000000000000ULL, 0x8000000000000000ULL },
+    { OP_FSUBD,  RN, 0x0010000000000000ULL, 0x3FE0000000000000ULL, 0xBFE0000000000000ULL },
+    { OP_FSUBD,  RN, 0x0000000000000001ULL, 0x3FF0000000000000ULL, 0xBFF0000000000000ULL },
+    { OP_FSUBD,  RN, 0x7FF0000000000000ULL, 0xFFF0000000000000ULL, 0x7FF0000000000000ULL },
+    { OP_FSUBD,  RN, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FSUBD,  RN, 0x3FF0000000000000ULL, 0x0000000000000000ULL, 0x3FF0000000000000ULL },
+    { OP_FSUBD,  RN, 0x7FF8000012345678ULL, 0x3FF0000000000000ULL, 0x7FF8000000000000ULL },
+    { OP_FSUBD,  RN, 0x7FF0000000000001ULL, 0x3FF0000000000000ULL, 0x7FF8000000000000ULL },
+    { OP_FSUBD,  RP, 0x3FF0000000000000ULL, 0x4008000000000000ULL, 0xC000000000000000ULL },
+    { OP_FSUBD,  RP, 0xBFF0000000000000ULL, 0x4008000000000000ULL, 0xC010000000000000ULL },
+    { OP_FSUBD,  RP, 0x4000000000000000ULL, 0x4008000000000000ULL, 0xBFF0000000000000ULL },
+    { OP_FSUBD,  RP, 0x3FB999999999999AULL, 0x3FC999999999999AULL, 0xBFB999999999999AULL },
+    { OP_FSUBD,  RP, 0x3FF0000000000000ULL, 0x3CA0000000000000ULL, 0x3FEFFFFFFFFFFFFFULL },
+    { OP_FSUBD,  RP, 0x3FF0000000000000ULL, 0x3CA8000000000000ULL, 0x3FEFFFFFFFFFFFFFULL },
+    { OP_FSUBD,  RP, 0x7FEFFFFFFFFFFFFFULL, 0x7FEFFFFFFFFFFFFFULL, 0x0000000000000000ULL },
+    { OP_FSUBD,  RP, 0x7E37E43C8800759CULL, 0x7E37E43C8800759CULL, 0x0000000000000000ULL },
+    { OP_FSUBD,  RM, 0x3FF0000000000000ULL, 0x4008000000000000ULL, 0xC000000000000000ULL },
+    { OP_FSUBD,  RM, 0xBFF0000000000000ULL, 0x4008000000000000ULL, 0xC010000000000000ULL },
+    { OP_FSUBD,  RM, 0x4000000000000000ULL, 0x4008000000000000ULL, 0xBFF0000000000000ULL },
+    { OP_FSUBD,  RM, 0x3FB999999999999AULL, 0x3FC999999999999AULL, 0xBFB999999999999AULL },
+    { OP_FSUBD,  RM, 0x3FF0000000000000ULL, 0x3CA0000000000000ULL, 0x3FEFFFFFFFFFFFFFULL },
+    { OP_FSUBD,  RM, 0x3FF0000000000000ULL, 0x3CA8000000000000ULL, 0x3FEFFFFFFFFFFFFEULL },
+    { OP_FSUBD,  RM, 0x7FEFFFFFFFFFFFFFULL, 0x7FEFFFFFFFFFFFFFULL, 0x8000000000000000ULL },
+    { OP_FSUBD,  RM, 0x7E37E43C8800759CULL, 0x7E37E43C8800759CULL, 0x8000000000000000ULL },
+    { OP_FSUBD,  RZ, 0x3FF0000000000000ULL, 0x4008000000000000ULL, 0xC000000000000000ULL },
+    { OP_FSUBD,  RZ, 0xBFF0000000000000ULL, 0x4008000000000000ULL, 0xC010000000000000ULL },
+    { OP_FSUBD,  RZ, 0x4000000000000000ULL, 0x4008000000000000ULL, 0xBFF0000000000000ULL },
+    { OP_FSUBD,  RZ, 0x3FB999999999999AULL, 0x3FC999999999999AULL, 0xBFB999999999999AULL },
+    { OP_FSUBD,  RZ, 0x3FF0000000000000ULL, 0x3CA0000000000000ULL, 0x3FEFFFFFFFFFFFFFULL },
+    { OP_FSUBD,  RZ, 0x3FF0000000000000ULL, 0x3CA8000000000000ULL, 0x3FEFFFFFFFFFFFFEULL },
+    { OP_FSUBD,  RZ, 0x7FEFFFFFFFFFFFFFULL, 0x7FEFFFFFFFFFFFFFULL, 0x0000000000000000ULL },
+    { OP_FSUBD,  RZ, 0x7E37E43C8800759CULL, 0x7E37E43C8800759CULL, 0x0000000000000000ULL },
+    { OP_FMULD,  RN, 0x3FF0000000000000ULL, 0x4008000000000000ULL, 0x4008000000000000ULL },
+    { OP_FMULD,  RN, 0xBFF0000000000000ULL, 0x4008000000000000ULL, 0xC008000000000000ULL },
+    { OP_FMULD,  RN, 0x4000000000000000ULL, 0x4008000000000000ULL, 0x4018000000000000ULL },
+    { OP_FMULD,  RN, 0x3FB999999999999AULL, 0x3FC999999999999AULL, 0x3F947AE147AE147CULL },
+    { OP_FMULD,  RN, 0x3FF0000000000000ULL, 0x3CA0000000000000ULL, 0x3CA0000000000000ULL },
+    { OP_FMULD,  RN, 0x3FF0000000000000ULL, 0x3CA8000000000000ULL, 0x3CA8000000000000ULL },
+    { OP_FMULD,  RN, 0x7FEFFFFFFFFFFFFFULL, 0x7FEFFFFFFFFFFFFFULL, 0x7FF0000000000000ULL },
+    { OP_FMULD,  RN, 0x7E37E43C8800759CULL, 0x7E37E43C8800759CULL, 0x7FF0000000000000ULL },
+    { OP_FMULD,  RN, 0x8000000000000000ULL, 0x0000000000000000ULL, 0x8000000000000000ULL },
+    { OP_FMULD,  RN, 0x0010000000000000ULL, 0x3FE0000000000000ULL, 0x0000000000000000ULL },
+    { OP_FMULD,  RN, 0x0000000000000001ULL, 0x3FF0000000000000ULL, 0x0000000000000000ULL },
+    { OP_FMULD,  RN, 0x7FF0000000000000ULL, 0xFFF0000000000000ULL, 0xFFF0000000000000ULL },
+    { OP_FMULD,  RN, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FMULD,  RN, 0x3FF0000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FMULD,  RN, 0x7FF8000012345678ULL, 0x3FF0000000000000ULL, 0x7FF8000000000000ULL },
+    { OP_FMULD,  RN, 0x7FF0000000000001ULL, 0x3FF0000000000000ULL, 0x7FF8000000000000ULL },
+    { OP_FMULD,  RP, 0x3FF0000000000000ULL, 0x4008000000000000ULL, 0x4008000000000000ULL },
+    { OP_FMULD,  RP, 0xBFF0000000000000ULL, 0x4008000000000000ULL, 0xC008000000000000ULL },
+    { OP_FMULD,  RP, 0x4000000000000000ULL, 0x4008000000000000ULL, 0x4018000000000000ULL },
+    { OP_FMULD,  RP, 0x3FB999999999999AULL, 0x3FC999999999999AULL, 0x3F947AE147AE147CULL },
+    { OP_FMULD,  RP, 0x3FF0000000000000ULL, 0x3CA0000000000000ULL, 0x3CA0000000000000ULL },
+    { OP_FMULD,  RP, 0x3FF0000000000000ULL, 0x3CA8000000000000ULL, 0x3CA8000000000000ULL },
+    { OP_FMULD,  RP, 0x7FEFFFFFFFFFFFFFULL, 0x7FEFFFFFFFFFFFFFULL, 0x7FF0000000000000ULL },
+    { OP_FMULD,  RP, 0x7E37E43C8800759CULL, 0x7E37E43C8800759CULL, 0x7FF0000000000000ULL },
+    { OP_FMULD,  RM, 0x3FF0000000000000ULL, 0x4008000000000000ULL, 0x4008000000000000ULL },
+    { OP_FMULD,  RM, 0xBFF0000000000000ULL, 0x4008000000000000ULL, 0xC008000000000000ULL },
+    { OP_FMULD,  RM, 0x4000000000000000ULL, 0x4008000000000000ULL, 0x4018000000000000ULL },
+    { OP_FMULD,  RM, 0x3FB999999999999AULL, 0x3FC999999999999AULL, 0x3F947AE147AE147BULL },
+    { OP_FMULD,  RM, 0x3FF0000000000000ULL, 0x3CA0000000000000ULL, 0x3CA0000000000000ULL },
+    { OP_FMULD,  RM, 0x3FF0000000000000ULL, 0x3CA8000000000000ULL, 0x3CA8000000000000ULL },
+    { OP_FMULD,  RM, 0x7FEFFFFFFFFFFFFFULL, 0x7FEFFFFFFFFFFFFFULL, 0x7FEFFFFFFFFFFFFFULL },
+    { OP_FMULD,  RM, 0x7E37E43C8800759CULL, 0x7E37E43C8800759CULL, 0x7FEFFFFFFFFFFFFFULL },
+    { OP_FMULD,  RZ, 0x3FF0000000000000ULL, 0x4008000000000000ULL, 0x4008000000000000ULL },
+    { OP_FMULD,  RZ, 0xBFF0000000000000ULL, 0x4008000000000000ULL, 0xC008000000000000ULL },
+    { OP_FMULD,  RZ, 0x4000000000000000ULL, 0x4008000000000000ULL, 0x4018000000000000ULL },
+    { OP_FMULD,  RZ, 0x3FB999999999999AULL, 0x3FC999999999999AULL, 0x3F947AE147AE147BULL },
+    { OP_FMULD,  RZ, 0x3FF0000000000000ULL, 0x3CA0000000000000ULL, 0x3CA0000000000000ULL },
+    { OP_FMULD,  RZ, 0x3FF0000000000000ULL, 0x3CA8000000000000ULL, 0x3CA8000000000000ULL },
+    { OP_FMULD,  RZ, 0x7FEFFFFFFFFFFFFFULL, 0x7FEFFFFFFFFFFFFFULL, 0x7FEFFFFFFFFFFFFFULL },
+    { OP_FMULD,  RZ, 0x7E37E43C8800759CULL, 0x7E37E43C8800759CULL, 0x7FEFFFFFFFFFFFFFULL },
+    { OP_FDIVD,  RN, 0x3FF0000000000000ULL, 0x4008000000000000ULL, 0x3FD5555555555555ULL },
+    { OP_FDIVD,  RN, 0xBFF0000000000000ULL, 0x4008000000000000ULL, 0xBFD5555555555555ULL },
+    { OP_FDIVD,  RN, 0x4000000000000000ULL, 0x4008000000000000ULL, 0x3FE5555555555555ULL },
+    { OP_FDIVD,  RN, 0x3FB999999999999AULL, 0x3FC999999999999AULL, 0x3FE0000000000000ULL },
+    { OP_FDIVD,  RN, 0x3FF0000000000000ULL, 0x3CA0000000000000ULL, 0x4340000000000000ULL },
+    { OP_FDIVD,  RN, 0x3FF0000000000000ULL, 0x3CA8000000000000ULL, 0x4335555555555555ULL },
+    { OP_FDIVD,  RN, 0x7FEFFFFFFFFFFFFFULL, 0x7FEFFFFFFFFFFFFFULL, 0x3FF0000000000000ULL },
+    { OP_FDIVD,  RN, 0x7E37E43C8800759CULL, 0x7E37E43C8800759CULL, 0x3FF0000000000000ULL },
+    { OP_FDIVD,  RN, 0x8000000000000000ULL, 0x0000000000000000ULL, 0x7FF8000000000000ULL },
+    { OP_FDIVD,  RN, 0x0010000000000000ULL, 0x3FE0000000000000ULL, 0x0020000000000000ULL },
+    { OP_FDIVD,  RN, 0x0000000000000001ULL, 0x3FF0000000000000ULL, 0x0000000000000000ULL },
+    { OP_FDIVD,  RN, 0x7FF0000000000000ULL, 0xFFF0000000000000ULL, 0x7FF8000000000000ULL },
+    { OP_FDIVD,  RN, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x7FF8000000000000ULL },
+    { OP_FDIVD,  RN, 0x3FF0000000000000ULL, 0x0000000000000000ULL, 0x7FF0000000000000ULL },
+    { OP_FDIVD,  RN, 0x7FF8000012345678ULL, 0x3FF0000000000000ULL, 0x7FF8000000000000ULL },
+    { OP_FDIVD,  RN, 0x7FF0000000000001ULL, 0x3FF0000000000000ULL, 0x7FF8000000000000ULL },
+    { OP_FDIVD,  RP, 0x3FF0000000000000ULL, 0x4008000000000000ULL, 0x3FD5555555555556ULL },
+    { OP_FDIVD,  RP, 0xBFF0000000000000ULL, 0x4008000000000000ULL, 0xBFD5555555555555ULL },
+    { OP_FDIVD,  RP, 0x4000000000000000ULL, 0x4008000000000000ULL, 0x3FE5555555555556ULL },
+    { OP_FDIVD,  RP, 0x3FB999999999999AULL, 0x3FC999999999999AULL, 0x3FE0000000000000ULL },
+    { OP_FDIVD,  RP, 0x3FF0000000000000ULL, 0x3CA0000000000000ULL, 0x4340000000000000ULL },
+    { OP_FDIVD,  RP, 0x3FF0000000000000ULL, 0x3CA8000000000000ULL, 0x4335555555555556ULL },
+    { OP_FDIVD,  RP, 0x7FEFFFFFFFFFFFFFULL, 0x7FEFFFFFFFFFFFFFULL, 0x3FF0000000000000ULL },
+    { OP_FDIVD,  RP, 0x7E37E43C8800759CULL, 0x7E37E43C8800759CULL, 0x3FF0000000000000ULL },
+    { OP_FDIVD,  RM, 0x3FF0000000000000ULL, 0x4008000000000000ULL, 0x3FD5555555555555ULL },
+    { OP_FDIVD,  RM, 0xBFF0000000000000ULL, 0x4008000000000000ULL, 0xBFD5555555555556ULL },
+    { OP_FDIVD,  RM, 0x4000000000000000ULL, 0x4008000000000000ULL, 0x3FE5555555555555ULL },
+    { OP_FDIVD,  RM, 0x3FB999999999999AULL, 0x3FC999999999999AULL, 0x3FE0000000000000ULL },
+    { OP_FDIVD,  RM, 0x3FF0000000000000ULL, 0x3CA0000000000000ULL, 0x4340000000000000ULL },
+    { OP_FDIVD,  RM, 0x3FF0000000000000ULL, 0x3CA8000000000000ULL, 0x4335555555555555ULL },
+    { OP_FDIVD,  RM, 0x7FEFFFFFFFFFFFFFULL, 0x7FEFFFFFFFFFFFFFULL, 0x3FF0000000000000ULL },
+    { OP_FDIVD,  RM, 0x7E37E43C8800759CULL, 0x7E37E43C8800759CULL, 0x3FF0000000000000ULL },
+    { OP_FDIVD,  RZ, 0x3FF0000000000000ULL, 0x4008000000000000ULL, 0x3FD5555555555555ULL },
+    { OP_FDIVD,  RZ, 0xBFF0000000000000ULL, 0x4008000000000000ULL, 0xBFD5555555555555ULL },
+    { OP_FDIVD,  RZ, 0x4000000000000000ULL, 0x4008000000000000ULL, 0x3FE5555555555555ULL },
+    { OP_FDIVD,  RZ, 0x3FB999999999999AULL, 0x3FC999999999999AULL, 0x3FE0000000000000ULL },
+    { OP_FDIVD,  RZ, 0x3FF0000000000000ULL, 0x3CA0000000000000ULL, 0x4340000000000000ULL },
+    { OP_FDIVD,  RZ, 0x3FF0000000000000ULL, 0x3CA8000000000000ULL, 0x4335555555555555ULL },
+    { OP_FDIVD,  RZ, 0x7FEFFFFFFFFFFFFFULL, 0x7FEFFFFFFFFFFFFFULL, 0x3FF0000000000000ULL },
+    { OP_FDIVD,  RZ, 0x7E37E43C8800759CULL, 0x7E37E43C8800759CULL, 0x3FF0000000000000ULL },
+    { OP_FSQRTD, RN, 0x3FF0000000000000ULL, 0x0000000000000000ULL, 0x3FF0000000000000ULL },
+    { OP_FSQRTD, RN, 0xBFF0000000000000ULL, 0x0000000000000000ULL, 0x7FF8000000000000ULL },
+    { OP_FSQRTD, RN, 0x4000000000000000ULL, 0x0000000000000000ULL, 0x3FF6A09E667F3BCDULL },
+    { OP_FSQRTD, RN, 0x3FB999999999999AULL, 0x0000000000000000ULL, 0x3FD43D136248490FULL },
+    { OP_FSQRTD, RN, 0x7FEFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0x5FEFFFFFFFFFFFFFULL },
+    { OP_FSQRTD, RN, 0x7E37E43C8800759CULL, 0x0000000000000000ULL, 0x5F138D352E5096AFULL },
+    { OP_FSQRTD, RN, 0x8000000000000000ULL, 0x0000000000000000ULL, 0x8000000000000000ULL },
+    { OP_FSQRTD, RN, 0x0010000000000000ULL, 0x0000000000000000ULL, 0x2000000000000000ULL },
+    { OP_FSQRTD, RN, 0x0000000000000001ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FSQRTD, RN, 0x7FF0000000000000ULL, 0x0000000000000000ULL, 0x7FF0000000000000ULL },
+    { OP_FSQRTD, RN, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FSQRTD, RN, 0x7FF8000012345678ULL, 0x0000000000000000ULL, 0x7FF8000000000000ULL },
+    { OP_FSQRTD, RN, 0x7FF0000000000001ULL, 0x0000000000000000ULL, 0x7FF8000000000000ULL },
+    { OP_FSQRTD, RP, 0x3FF0000000000000ULL, 0x0000000000000000ULL, 0x3FF0000000000000ULL },
+    { OP_FSQRTD, RP, 0xBFF0000000000000ULL, 0x0000000000000000ULL, 0x7FF8000000000000ULL },
+    { OP_FSQRTD, RP, 0x4000000000000000ULL, 0x0000000000000000ULL, 0x3FF6A09E667F3BCDULL },
+    { OP_FSQRTD, RP, 0x3FB999999999999AULL, 0x0000000000000000ULL, 0x3FD43D1362484910ULL },
+    { OP_FSQRTD, RP, 0x7FEFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0x5FF0000000000000ULL },
+    { OP_FSQRTD, RP, 0x7E37E43C8800759CULL, 0x0000000000000000ULL, 0x5F138D352E5096B0ULL },
+    { OP_FSQRTD, RM, 0x3FF0000000000000ULL, 0x0000000000000000ULL, 0x3FF0000000000000ULL },
+    { OP_FSQRTD, RM, 0xBFF0000000000000ULL, 0x0000000000000000ULL, 0x7FF8000000000000ULL },
+    { OP_FSQRTD, RM, 0x4000000000000000ULL, 0x0000000000000000ULL, 0x3FF6A09E667F3BCCULL },
+    { OP_FSQRTD, RM, 0x3FB999999999999AULL, 0x0000000000000000ULL, 0x3FD43D136248490FULL },
+    { OP_FSQRTD, RM, 0x7FEFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0x5FEFFFFFFFFFFFFFULL },
+    { OP_FSQRTD, RM, 0x7E37E43C8800759CULL, 0x0000000000000000ULL, 0x5F138D352E5096AFULL },
+    { OP_FSQRTD, RZ, 0x3FF0000000000000ULL, 0x0000000000000000ULL, 0x3FF0000000000000ULL },
+    { OP_FSQRTD, RZ, 0xBFF0000000000000ULL, 0x0000000000000000ULL, 0x7FF8000000000000ULL },
+    { OP_FSQRTD, RZ, 0x4000000000000000ULL, 0x0000000000000000ULL, 0x3FF6A09E667F3BCCULL },
+    { OP_FSQRTD, RZ, 0x3FB999999999999AULL, 0x0000000000000000ULL, 0x3FD43D136248490FULL },
+    { OP_FSQRTD, RZ, 0x7FEFFFFFFFFFFFFFULL, 0x0000000000000000ULL, 0x5FEFFFFFFFFFFFFFULL },
+    { OP_FSQRTD, RZ, 0x7E37E43C8800759CULL, 0x0000000000000000ULL, 0x5F138D352E5096AFULL },
+    { OP_FTOSIS, RN, 0x0000000040200000ULL, 0x0000000000000000ULL, 0x0000000000000002ULL },
+    { OP_FTOSIZS, RN, 0x0000000040200000ULL, 0x0000000000000000ULL, 0x0000000000000002ULL },
+    { OP_FTOUIS, RN, 0x0000000040200000ULL, 0x0000000000000000ULL, 0x0000000000000002ULL },
+    { OP_FTOSIS, RN, 0x00000000C0200000ULL, 0x0000000000000000ULL, 0x00000000FFFFFFFEULL },
+    { OP_FTOSIZS, RN, 0x00000000C0200000ULL, 0x0000000000000000ULL, 0x00000000FFFFFFFEULL },
+    { OP_FTOUIS, RN, 0x00000000C0200000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOSIS, RN, 0x0000000040600000ULL, 0x0000000000000000ULL, 0x0000000000000004ULL },
+    { OP_FTOSIZS, RN, 0x0000000040600000ULL, 0x0000000000000000ULL, 0x0000000000000003ULL },
+    { OP_FTOUIS, RN, 0x0000000040600000ULL, 0x0000000000000000ULL, 0x0000000000000004ULL },
+    { OP_FTOSIS, RN, 0x00000000BF000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOSIZS, RN, 0x00000000BF000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOUIS, RN, 0x00000000BF000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOSIS, RN, 0x000000003F000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOSIZS, RN, 0x000000003F000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOUIS, RN, 0x000000003F000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOSIS, RN, 0x00000000501502F9ULL, 0x0000000000000000ULL, 0x000000007FFFFFFFULL },
+    { OP_FTOSIZS, RN, 0x00000000501502F9ULL, 0x0000000000000000ULL, 0x000000007FFFFFFFULL },
+    { OP_FTOUIS, RN, 0x00000000501502F9ULL, 0x0000000000000000ULL, 0x00000000FFFFFFFFULL },
+    { OP_FTOSIS, RN, 0x00000000D01502F9ULL, 0x0000000000000000ULL, 0x0000000080000000ULL },
+    { OP_FTOSIZS, RN, 0x00000000D01502F9ULL, 0x0000000000000000ULL, 0x0000000080000000ULL },
+    { OP_FTOUIS, RN, 0x00000000D01502F9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOSIS, RN, 0x000000004EFFFFFFULL, 0x0000000000000000ULL, 0x000000007FFFFF80ULL },
+    { OP_FTOSIZS, RN, 0x000000004EFFFFFFULL, 0x0000000000000000ULL, 0x000000007FFFFF80ULL },
+    { OP_FTOUIS, RN, 0x000000004EFFFFFFULL, 0x0000000000000000ULL, 0x000000007FFFFF80ULL },
+    { OP_FTOSIS, RN, 0x000000004F000000ULL, 0x0000000000000000ULL, 0x000000007FFFFFFFULL },
+    { OP_FTOSIZS, RN, 0x000000004F000000ULL, 0x0000000000000000ULL, 0x000000007FFFFFFFULL },
+    { OP_FTOUIS, RN, 0x000000004F000000ULL, 0x0000000000000000ULL, 0x0000000080000000ULL },
+    { OP_FTOSIS, RN, 0x000000004F800000ULL, 0x0000000000000000ULL, 0x000000007FFFFFFFULL },
+    { OP_FTOSIZS, RN, 0x000000004F800000ULL, 0x0000000000000000ULL, 0x000000007FFFFFFFULL },
+    { OP_FTOUIS, RN, 0x000000004F800000ULL, 0x0000000000000000ULL, 0x00000000FFFFFFFFULL },
+    { OP_FTOSIS, RN, 0x000000007FC00000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOSIZS, RN, 0x000000007FC00000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOUIS, RN, 0x000000007FC00000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOSIS, RN, 0x000000007F800000ULL, 0x0000000000000000ULL, 0x000000007FFFFFFFULL },
+    { OP_FTOSIZS, RN, 0x000000007F800000ULL, 0x0000000000000000ULL, 0x000000007FFFFFFFULL },
+    { OP_FTOUIS, RN, 0x000000007F800000ULL, 0x0000000000000000ULL, 0x00000000FFFFFFFFULL },
+    { OP_FTOSIS, RN, 0x00000000FF800000ULL, 0x0000000000000000ULL, 0x0000000080000000ULL },
+    { OP_FTOSIZS, RN, 0x00000000FF800000ULL, 0x0000000000000000ULL, 0x0000000080000000ULL },
+    { OP_FTOUIS, RN, 0x00000000FF800000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOSIS, RN, 0x0000000080000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOSIZS, RN, 0x0000000080000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOUIS, RN, 0x0000000080000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOSIS, RN, 0x0000000000000001ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOSIZS, RN, 0x0000000000000001ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOUIS, RN, 0x0000000000000001ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FSITOS, RN, 0x000000007FFFFFFFULL, 0x0000000000000000ULL, 0x000000004F000000ULL },
+    { OP_FSITOS, RN, 0x0000000080000000ULL, 0x0000000000000000ULL, 0x00000000CF000000ULL },
+    { OP_FSITOS, RN, 0x0000000001000001ULL, 0x0000000000000000ULL, 0x000000004B800000ULL },
+    { OP_FSITOS, RN, 0x00000000FEFFFFFFULL, 0x0000000000000000ULL, 0x00000000CB800000ULL },
+    { OP_FSITOS, RN, 0x0000000000000001ULL, 0x0000000000000000ULL, 0x000000003F800000ULL },
+    { OP_FSITOS, RN, 0x00000000FFFFFFFFULL, 0x0000000000000000ULL, 0x00000000BF800000ULL },
+    { OP_FCVTSD, RN, 0x3FD5555555555555ULL, 0x0000000000000000ULL, 0x000000003EAAAAABULL },
+    { OP_FCVTSD, RN, 0xBFD5555555555555ULL, 0x0000000000000000ULL, 0x00000000BEAAAAABULL },
+    { OP_FCVTSD, RN, 0x7E37E43C8800759CULL, 0x0000000000000000ULL, 0x000000007F800000ULL },
+    { OP_FCVTSD, RN, 0xFE37E43C8800759CULL, 0x0000000000000000ULL, 0x00000000FF800000ULL },
+    { OP_FCVTSD, RN, 0x37A16C262777579CULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FCVTSD, RN, 0x0000000000000001ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FCVTSD, RN, 0x7FF0000000000001ULL, 0x0000000000000000ULL, 0x000000007FC00000ULL },
+    { OP_FCVTSD, RN, 0x4005BF0A8B145769ULL, 0x0000000000000000ULL, 0x00000000402DF854ULL },
+    { OP_FTOSIS, RP, 0x0000000040200000ULL, 0x0000000000000000ULL, 0x0000000000000003ULL },
+    { OP_FTOSIZS, RP, 0x0000000040200000ULL, 0x0000000000000000ULL, 0x0000000000000002ULL },
+    { OP_FTOUIS, RP, 0x0000000040200000ULL, 0x0000000000000000ULL, 0x0000000000000003ULL },
+    { OP_FTOSIS, RP, 0x00000000C0200000ULL, 0x0000000000000000ULL, 0x00000000FFFFFFFEULL },
+    { OP_FTOSIZS, RP, 0x00000000C0200000ULL, 0x0000000000000000ULL, 0x00000000FFFFFFFEULL },
+    { OP_FTOUIS, RP, 0x00000000C0200000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOSIS, RP, 0x0000000040600000ULL, 0x0000000000000000ULL, 0x0000000000000004ULL },
+    { OP_FTOSIZS, RP, 0x0000000040600000ULL, 0x0000000000000000ULL, 0x0000000000000003ULL },
+    { OP_FTOUIS, RP, 0x0000000040600000ULL, 0x0000000000000000ULL, 0x0000000000000004ULL },
+    { OP_FTOSIS, RP, 0x00000000BF000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOSIZS, RP, 0x00000000BF000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOUIS, RP, 0x00000000BF000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOSIS, RP, 0x000000003F000000ULL, 0x0000000000000000ULL, 0x0000000000000001ULL },
+    { OP_FTOSIZS, RP, 0x000000003F000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOUIS, RP, 0x000000003F000000ULL, 0x0000000000000000ULL, 0x0000000000000001ULL },
+    { OP_FTOSIS, RP, 0x00000000501502F9ULL, 0x0000000000000000ULL, 0x000000007FFFFFFFULL },
+    { OP_FTOSIZS, RP, 0x00000000501502F9ULL, 0x0000000000000000ULL, 0x000000007FFFFFFFULL },
+    { OP_FTOUIS, RP, 0x00000000501502F9ULL, 0x0000000000000000ULL, 0x00000000FFFFFFFFULL },
+    { OP_FTOSIS, RP, 0x00000000D01502F9ULL, 0x0000000000000000ULL, 0x0000000080000000ULL },
+    { OP_FTOSIZS, RP, 0x00000000D01502F9ULL, 0x0000000000000000ULL, 0x0000000080000000ULL },
+    { OP_FTOUIS, RP, 0x00000000D01502F9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOSIS, RP, 0x000000004EFFFFFFULL, 0x0000000000000000ULL, 0x000000007FFFFF80ULL },
+    { OP_FTOSIZS, RP, 0x000000004EFFFFFFULL, 0x0000000000000000ULL, 0x000000007FFFFF80ULL },
+    { OP_FTOUIS, RP, 0x000000004EFFFFFFULL, 0x0000000000000000ULL, 0x000000007FFFFF80ULL },
+    { OP_FTOSIS, RP, 0x000000004F000000ULL, 0x0000000000000000ULL, 0x000000007FFFFFFFULL },
+    { OP_FTOSIZS, RP, 0x000000004F000000ULL, 0x0000000000000000ULL, 0x000000007FFFFFFFULL },
+    { OP_FTOUIS, RP, 0x000000004F000000ULL, 0x0000000000000000ULL, 0x0000000080000000ULL },
+    { OP_FTOSIS, RP, 0x000000004F800000ULL, 0x0000000000000000ULL, 0x000000007FFFFFFFULL },
+    { OP_FTOSIZS, RP, 0x000000004F800000ULL, 0x0000000000000000ULL, 0x000000007FFFFFFFULL },
+    { OP_FTOUIS, RP, 0x000000004F800000ULL, 0x0000000000000000ULL, 0x00000000FFFFFFFFULL },
+    { OP_FTOSIS, RP, 0x000000007FC00000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOSIZS, RP, 0x000000007FC00000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOUIS, RP, 0x000000007FC00000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOSIS, RP, 0x000000007F800000ULL, 0x0000000000000000ULL, 0x000000007FFFFFFFULL },
+    { OP_FTOSIZS, RP, 0x000000007F800000ULL, 0x0000000000000000ULL, 0x000000007FFFFFFFULL },
+    { OP_FTOUIS, RP, 0x000000007F800000ULL, 0x0000000000000000ULL, 0x00000000FFFFFFFFULL },
+    { OP_FTOSIS, RP, 0x00000000FF800000ULL, 0x0000000000000000ULL, 0x0000000080000000ULL },
+    { OP_FTOSIZS, RP, 0x00000000FF800000ULL, 0x0000000000000000ULL, 0x0000000080000000ULL },
+    { OP_FTOUIS, RP, 0x00000000FF800000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOSIS, RP, 0x0000000080000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOSIZS, RP, 0x0000000080000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOUIS, RP, 0x0000000080000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOSIS, RP, 0x0000000000000001ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOSIZS, RP, 0x0000000000000001ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOUIS, RP, 0x0000000000000001ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FSITOS, RP, 0x000000007FFFFFFFULL, 0x0000000000000000ULL, 0x000000004F000000ULL },
+    { OP_FSITOS, RP, 0x0000000080000000ULL, 0x0000000000000000ULL, 0x00000000CF000000ULL },
+    { OP_FSITOS, RP, 0x0000000001000001ULL, 0x0000000000000000ULL, 0x000000004B800001ULL },
+    { OP_FSITOS, RP, 0x00000000FEFFFFFFULL, 0x0000000000000000ULL, 0x00000000CB800000ULL },
+    { OP_FSITOS, RP, 0x0000000000000001ULL, 0x0000000000000000ULL, 0x000000003F800000ULL },
+    { OP_FSITOS, RP, 0x00000000FFFFFFFFULL, 0x0000000000000000ULL, 0x00000000BF800000ULL },
+    { OP_FCVTSD, RP, 0x3FD5555555555555ULL, 0x0000000000000000ULL, 0x000000003EAAAAABULL },
+    { OP_FCVTSD, RP, 0xBFD5555555555555ULL, 0x0000000000000000ULL, 0x00000000BEAAAAAAULL },
+    { OP_FCVTSD, RP, 0x7E37E43C8800759CULL, 0x0000000000000000ULL, 0x000000007F800000ULL },
+    { OP_FCVTSD, RP, 0xFE37E43C8800759CULL, 0x0000000000000000ULL, 0x00000000FF7FFFFFULL },
+    { OP_FCVTSD, RP, 0x37A16C262777579CULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FCVTSD, RP, 0x0000000000000001ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FCVTSD, RP, 0x7FF0000000000001ULL, 0x0000000000000000ULL, 0x000000007FC00000ULL },
+    { OP_FCVTSD, RP, 0x4005BF0A8B145769ULL, 0x0000000000000000ULL, 0x00000000402DF855ULL },
+    { OP_FTOSIS, RM, 0x0000000040200000ULL, 0x0000000000000000ULL, 0x0000000000000002ULL },
+    { OP_FTOSIZS, RM, 0x0000000040200000ULL, 0x0000000000000000ULL, 0x0000000000000002ULL },
+    { OP_FTOUIS, RM, 0x0000000040200000ULL, 0x0000000000000000ULL, 0x0000000000000002ULL },
+    { OP_FTOSIS, RM, 0x00000000C0200000ULL, 0x0000000000000000ULL, 0x00000000FFFFFFFDULL },
+    { OP_FTOSIZS, RM, 0x00000000C0200000ULL, 0x0000000000000000ULL, 0x00000000FFFFFFFEULL },
+    { OP_FTOUIS, RM, 0x00000000C0200000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOSIS, RM, 0x0000000040600000ULL, 0x0000000000000000ULL, 0x0000000000000003ULL },
+    { OP_FTOSIZS, RM, 0x0000000040600000ULL, 0x0000000000000000ULL, 0x0000000000000003ULL },
+    { OP_FTOUIS, RM, 0x0000000040600000ULL, 0x0000000000000000ULL, 0x0000000000000003ULL },
+    { OP_FTOSIS, RM, 0x00000000BF000000ULL, 0x0000000000000000ULL, 0x00000000FFFFFFFFULL },
+    { OP_FTOSIZS, RM, 0x00000000BF000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOUIS, RM, 0x00000000BF000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOSIS, RM, 0x000000003F000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOSIZS, RM, 0x000000003F000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOUIS, RM, 0x000000003F000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOSIS, RM, 0x00000000501502F9ULL, 0x0000000000000000ULL, 0x000000007FFFFFFFULL },
+    { OP_FTOSIZS, RM, 0x00000000501502F9ULL, 0x0000000000000000ULL, 0x000000007FFFFFFFULL },
+    { OP_FTOUIS, RM, 0x00000000501502F9ULL, 0x0000000000000000ULL, 0x00000000FFFFFFFFULL },
+    { OP_FTOSIS, RM, 0x00000000D01502F9ULL, 0x0000000000000000ULL, 0x0000000080000000ULL },
+    { OP_FTOSIZS, RM, 0x00000000D01502F9ULL, 0x0000000000000000ULL, 0x0000000080000000ULL },
+    { OP_FTOUIS, RM, 0x00000000D01502F9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOSIS, RM, 0x000000004EFFFFFFULL, 0x0000000000000000ULL, 0x000000007FFFFF80ULL },
+    { OP_FTOSIZS, RM, 0x000000004EFFFFFFULL, 0x0000000000000000ULL, 0x000000007FFFFF80ULL },
+    { OP_FTOUIS, RM, 0x000000004EFFFFFFULL, 0x0000000000000000ULL, 0x000000007FFFFF80ULL },
+    { OP_FTOSIS, RM, 0x000000004F000000ULL, 0x0000000000000000ULL, 0x000000007FFFFFFFULL },
+    { OP_FTOSIZS, RM, 0x000000004F000000ULL, 0x0000000000000000ULL, 0x000000007FFFFFFFULL },
+    { OP_FTOUIS, RM, 0x000000004F000000ULL, 0x0000000000000000ULL, 0x0000000080000000ULL },
+    { OP_FTOSIS, RM, 0x000000004F800000ULL, 0x0000000000000000ULL, 0x000000007FFFFFFFULL },
+    { OP_FTOSIZS, RM, 0x000000004F800000ULL, 0x0000000000000000ULL, 0x000000007FFFFFFFULL },
+    { OP_FTOUIS, RM, 0x000000004F800000ULL, 0x0000000000000000ULL, 0x00000000FFFFFFFFULL },
+    { OP_FTOSIS, RM, 0x000000007FC00000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOSIZS, RM, 0x000000007FC00000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOUIS, RM, 0x000000007FC00000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOSIS, RM, 0x000000007F800000ULL, 0x0000000000000000ULL, 0x000000007FFFFFFFULL },
+    { OP_FTOSIZS, RM, 0x000000007F800000ULL, 0x0000000000000000ULL, 0x000000007FFFFFFFULL },
+    { OP_FTOUIS, RM, 0x000000007F800000ULL, 0x0000000000000000ULL, 0x00000000FFFFFFFFULL },
+    { OP_FTOSIS, RM, 0x00000000FF800000ULL, 0x0000000000000000ULL, 0x0000000080000000ULL },
+    { OP_FTOSIZS, RM, 0x00000000FF800000ULL, 0x0000000000000000ULL, 0x0000000080000000ULL },
+    { OP_FTOUIS, RM, 0x00000000FF800000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOSIS, RM, 0x0000000080000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOSIZS, RM, 0x0000000080000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOUIS, RM, 0x0000000080000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOSIS, RM, 0x0000000000000001ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOSIZS, RM, 0x0000000000000001ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOUIS, RM, 0x0000000000000001ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FSITOS, RM, 0x000000007FFFFFFFULL, 0x0000000000000000ULL, 0x000000004EFFFFFFULL },
+    { OP_FSITOS, RM, 0x0000000080000000ULL, 0x0000000000000000ULL, 0x00000000CF000000ULL },
+    { OP_FSITOS, RM, 0x0000000001000001ULL, 0x0000000000000000ULL, 0x000000004B800000ULL },
+    { OP_FSITOS, RM, 0x00000000FEFFFFFFULL, 0x0000000000000000ULL, 0x00000000CB800001ULL },
+    { OP_FSITOS, RM, 0x0000000000000001ULL, 0x0000000000000000ULL, 0x000000003F800000ULL },
+    { OP_FSITOS, RM, 0x00000000FFFFFFFFULL, 0x0000000000000000ULL, 0x00000000BF800000ULL },
+    { OP_FCVTSD, RM, 0x3FD5555555555555ULL, 0x0000000000000000ULL, 0x000000003EAAAAAAULL },
+    { OP_FCVTSD, RM, 0xBFD5555555555555ULL, 0x0000000000000000ULL, 0x00000000BEAAAAABULL },
+    { OP_FCVTSD, RM, 0x7E37E43C8800759CULL, 0x0000000000000000ULL, 0x000000007F7FFFFFULL },
+    { OP_FCVTSD, RM, 0xFE37E43C8800759CULL, 0x0000000000000000ULL, 0x00000000FF800000ULL },
+    { OP_FCVTSD, RM, 0x37A16C262777579CULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FCVTSD, RM, 0x0000000000000001ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FCVTSD, RM, 0x7FF0000000000001ULL, 0x0000000000000000ULL, 0x000000007FC00000ULL },
+    { OP_FCVTSD, RM, 0x4005BF0A8B145769ULL, 0x0000000000000000ULL, 0x00000000402DF854ULL },
+    { OP_FTOSIS, RZ, 0x0000000040200000ULL, 0x0000000000000000ULL, 0x0000000000000002ULL },
+    { OP_FTOSIZS, RZ, 0x0000000040200000ULL, 0x0000000000000000ULL, 0x0000000000000002ULL },
+    { OP_FTOUIS, RZ, 0x0000000040200000ULL, 0x0000000000000000ULL, 0x0000000000000002ULL },
+    { OP_FTOSIS, RZ, 0x00000000C0200000ULL, 0x0000000000000000ULL, 0x00000000FFFFFFFEULL },
+    { OP_FTOSIZS, RZ, 0x00000000C0200000ULL, 0x0000000000000000ULL, 0x00000000FFFFFFFEULL },
+    { OP_FTOUIS, RZ, 0x00000000C0200000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOSIS, RZ, 0x0000000040600000ULL, 0x0000000000000000ULL, 0x0000000000000003ULL },
+    { OP_FTOSIZS, RZ, 0x0000000040600000ULL, 0x0000000000000000ULL, 0x0000000000000003ULL },
+    { OP_FTOUIS, RZ, 0x0000000040600000ULL, 0x0000000000000000ULL, 0x0000000000000003ULL },
+    { OP_FTOSIS, RZ, 0x00000000BF000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOSIZS, RZ, 0x00000000BF000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOUIS, RZ, 0x00000000BF000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOSIS, RZ, 0x000000003F000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOSIZS, RZ, 0x000000003F000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOUIS, RZ, 0x000000003F000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOSIS, RZ, 0x00000000501502F9ULL, 0x0000000000000000ULL, 0x000000007FFFFFFFULL },
+    { OP_FTOSIZS, RZ, 0x00000000501502F9ULL, 0x0000000000000000ULL, 0x000000007FFFFFFFULL },
+    { OP_FTOUIS, RZ, 0x00000000501502F9ULL, 0x0000000000000000ULL, 0x00000000FFFFFFFFULL },
+    { OP_FTOSIS, RZ, 0x00000000D01502F9ULL, 0x0000000000000000ULL, 0x0000000080000000ULL },
+    { OP_FTOSIZS, RZ, 0x00000000D01502F9ULL, 0x0000000000000000ULL, 0x0000000080000000ULL },
+    { OP_FTOUIS, RZ, 0x00000000D01502F9ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOSIS, RZ, 0x000000004EFFFFFFULL, 0x0000000000000000ULL, 0x000000007FFFFF80ULL },
+    { OP_FTOSIZS, RZ, 0x000000004EFFFFFFULL, 0x0000000000000000ULL, 0x000000007FFFFF80ULL },
+    { OP_FTOUIS, RZ, 0x000000004EFFFFFFULL, 0x0000000000000000ULL, 0x000000007FFFFF80ULL },
+    { OP_FTOSIS, RZ, 0x000000004F000000ULL, 0x0000000000000000ULL, 0x000000007FFFFFFFULL },
+    { OP_FTOSIZS, RZ, 0x000000004F000000ULL, 0x0000000000000000ULL, 0x000000007FFFFFFFULL },
+    { OP_FTOUIS, RZ, 0x000000004F000000ULL, 0x0000000000000000ULL, 0x0000000080000000ULL },
+    { OP_FTOSIS, RZ, 0x000000004F800000ULL, 0x0000000000000000ULL, 0x000000007FFFFFFFULL },
+    { OP_FTOSIZS, RZ, 0x000000004F800000ULL, 0x0000000000000000ULL, 0x000000007FFFFFFFULL },
+    { OP_FTOUIS, RZ, 0x000000004F800000ULL, 0x0000000000000000ULL, 0x00000000FFFFFFFFULL },
+    { OP_FTOSIS, RZ, 0x000000007FC00000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOSIZS, RZ, 0x000000007FC00000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOUIS, RZ, 0x000000007FC00000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOSIS, RZ, 0x000000007F800000ULL, 0x0000000000000000ULL, 0x000000007FFFFFFFULL },
+    { OP_FTOSIZS, RZ, 0x000000007F800000ULL, 0x0000000000000000ULL, 0x000000007FFFFFFFULL },
+    { OP_FTOUIS, RZ, 0x000000007F800000ULL, 0x0000000000000000ULL, 0x00000000FFFFFFFFULL },
+    { OP_FTOSIS, RZ, 0x00000000FF800000ULL, 0x0000000000000000ULL, 0x0000000080000000ULL },
+    { OP_FTOSIZS, RZ, 0x00000000FF800000ULL, 0x0000000000000000ULL, 0x0000000080000000ULL },
+    { OP_FTOUIS, RZ, 0x00000000FF800000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOSIS, RZ, 0x0000000080000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOSIZS, RZ, 0x0000000080000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOUIS, RZ, 0x0000000080000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOSIS, RZ, 0x0000000000000001ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOSIZS, RZ, 0x0000000000000001ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FTOUIS, RZ, 0x0000000000000001ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FSITOS, RZ, 0x000000007FFFFFFFULL, 0x0000000000000000ULL, 0x000000004EFFFFFFULL },
+    { OP_FSITOS, RZ, 0x0000000080000000ULL, 0x0000000000000000ULL, 0x00000000CF000000ULL },
+    { OP_FSITOS, RZ, 0x0000000001000001ULL, 0x0000000000000000ULL, 0x000000004B800000ULL },
+    { OP_FSITOS, RZ, 0x00000000FEFFFFFFULL, 0x0000000000000000ULL, 0x00000000CB800000ULL },
+    { OP_FSITOS, RZ, 0x0000000000000001ULL, 0x0000000000000000ULL, 0x000000003F800000ULL },
+    { OP_FSITOS, RZ, 0x00000000FFFFFFFFULL, 0x0000000000000000ULL, 0x00000000BF800000ULL },
+    { OP_FCVTSD, RZ, 0x3FD5555555555555ULL, 0x0000000000000000ULL, 0x000000003EAAAAAAULL },
+    { OP_FCVTSD, RZ, 0xBFD5555555555555ULL, 0x0000000000000000ULL, 0x00000000BEAAAAAAULL },
+    { OP_FCVTSD, RZ, 0x7E37E43C8800759CULL, 0x0000000000000000ULL, 0x000000007F7FFFFFULL },
+    { OP_FCVTSD, RZ, 0xFE37E43C8800759CULL, 0x0000000000000000ULL, 0x00000000FF7FFFFFULL },
+    { OP_FCVTSD, RZ, 0x37A16C262777579CULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FCVTSD, RZ, 0x0000000000000001ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+    { OP_FCVTSD, RZ, 0x7FF0000000000001ULL, 0x0000000000000000ULL, 0x000000007FC00000ULL },
+    { OP_FCVTSD, RZ, 0x4005BF0A8B145769ULL, 0x0000000000000000ULL, 0x00000000402DF854ULL },
+    { OP_FCVTDS, RN, 0x0000000040200000ULL, 0x0000000000000000ULL, 0x4004000000000000ULL },
+    { OP_FCVTDS, RN, 0x00000000C0200000ULL, 0x0000000000000000ULL, 0xC004000000000000ULL },
+    { OP_FCVTDS, RN, 0x0000000040600000ULL, 0x0000000000000000ULL, 0x400C000000000000ULL },
+    { OP_FCVTDS, RN, 0x00000000BF000000ULL, 0x0000000000000000ULL, 0xBFE0000000000000ULL },
+    { OP_FCVTDS, RN, 0x000000003F000000ULL, 0x0000000000000000ULL, 0x3FE0000000000000ULL },
+    { OP_FCVTDS, RN, 0x00000000501502F9ULL, 0x0000000000000000ULL, 0x4202A05F20000000ULL },
+    { OP_FCVTDS, RN, 0x00000000D01502F9ULL, 0x0000000000000000ULL, 0xC202A05F20000000ULL },
+    { OP_FCVTDS, RN, 0x000000004EFFFFFFULL, 0x0000000000000000ULL, 0x41DFFFFFE0000000ULL },
+    { OP_FCVTDS, RN, 0x000000004F000000ULL, 0x0000000000000000ULL, 0x41E0000000000000ULL },
+    { OP_FCVTDS, RN, 0x000000004F800000ULL, 0x0000000000000000ULL, 0x41F0000000000000ULL },
+    { OP_FCVTDS, RN, 0x000000007FC00000ULL, 0x0000000000000000ULL, 0x7FF8000000000000ULL },
+    { OP_FCVTDS, RN, 0x000000007F800000ULL, 0x0000000000000000ULL, 0x7FF0000000000000ULL },
+    { OP_FCVTDS, RN, 0x00000000FF800000ULL, 0x0000000000000000ULL, 0xFFF0000000000000ULL },
+    { OP_FCVTDS, RN, 0x0000000080000000ULL, 0x0000000000000000ULL, 0x8000000000000000ULL },
+    { OP_FCVTDS, RN, 0x0000000000000001ULL, 0x0000000000000000ULL, 0x0000000000000000ULL },
+};
@@ -1,11 +1,13 @@
 #include "tests/fs/fs.h"
-#include "tests/fs/fs_sdmc.h"
+#include "tests/fs/fs_archives.h"
+#include "tests/fs/fs_ipc.h"
 
 namespace FS {
 
 void TestAll()
 {
-    SDMC::TestAll();
+    Archives::TestAll();
+    IPC::TestAll();
 }
 
 } // namespace
@@ -0,0 +1,400 @@
+#include <algorithm>
+#include <memory>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <3ds.h>
+
+#include "output.h"
+#include "common/scope_exit.h"
+#include "common/string_funcs.h"
+#include "tests/benchmark.h"
+#include "tests/test.h"
+#include "tests/fs/fs_archives.h"
+
+namespace FS {
+namespace Archives {
+
+enum ArchiveFlags {
+    ARCHIVE_REQUIRED = 1 << 0,     ///< Failing to open it is a test failure rather than a skip
+    ARCHIVE_WRITABLE = 1 << 1,
+    ARCHIVE_FIXED_SIZE = 1 << 2,   ///< OpenFile can't create files and writes can't grow them
+    ARCHIVE_NEEDS_EXTDATA_ID = 1 << 3,
+};
+
+struct ArchiveInfo {
+    const char* name;
+    u32 id;
+    FS_path path;
+    u32 flags;
+};
+
+// ExtData is opened by ID, which the app has no way to look up, so it comes from the EXTDATA_ID
+// build option. Binary path: media type (1 = SD card), then the ID's low and high words.
+#ifdef EXTDATA_ID
+static const bool HAVE_EXTDATA_ID = true;
+static const u32 extdata_path[3] = { 1, (u32)(EXTDATA_ID), (u32)((u64)(EXTDATA_ID) >> 32) };
+#else
+static const bool HAVE_EXTDATA_ID = false;
+static const u32 extdata_path[3] = { 1, 0, 0 };
+#endif
+
+// SaveData, ExtData and RomFS belong to the title the app runs under, so they may not exist.
+static const ArchiveInfo ARCHIVES[] = {
+    { "SDMC",     0x00000009, { PATH_EMPTY, 1, (u8*) "" }, ARCHIVE_REQUIRED | ARCHIVE_WRITABLE },
+    { "SaveData", 0x00000004, { PATH_EMPTY, 1, (u8*) "" }, ARCHIVE_WRITABLE },
+    { "ExtData",  0x00000006, { PATH_BINARY, sizeof(extdata_path), (u8*) extdata_path },
+      ARCHIVE_WRITABLE | ARCHIVE_FIXED_SIZE | ARCHIVE_NEEDS_EXTDATA_ID },
+    { "RomFS",    0x00000003, { PATH_EMPTY, 1, (u8*) "" }, 0 },
+};
+static const u32 NUM_ARCHIVES = sizeof(ARCHIVES) / sizeof(ARCHIVES[0]);
+
+// Small enough to fit the smallest save data images
+static const u32 BENCH_FILE_SIZE = 128 * 1024;
+static const u32 BENCH_CHUNK_SIZES[] = { 4 * 1024, 64 * 1024 };
+static const u32 NUM_CHUNK_SIZES = sizeof(BENCH_CHUNK_SIZES) / sizeof(BENCH_CHUNK_SIZES[0]);
+static const int BENCH_PASSES = 4;
+
+/// Functional checks run on writable archives, a row of the checks table each
+enum Check {
+    CHECK_FILE_CREATE_DELETE,
+    CHECK_FILE_RENAME,
+    CHECK_FILE_WRITE_READ,
+    CHECK_DIR_CREATE_DELETE,
+    CHECK_DIR_RENAME,
+    NUM_CHECKS
+};
+static const char* const CHECK_NAMES[NUM_CHECKS] = {
+    "File create/delete", "File rename", "File write/read", "Dir create/delete", "Dir rename",
+};
+
+/// Rows of the throughput table, each with a column per chunk size
+enum Direction {
+    DIRECTION_WRITE,
+    DIRECTION_READ,
+    NUM_DIRECTIONS
+};
+
+static bool TestFileCreateDelete(FS_archive archive, bool fixed_size)
+{
+    Handle fileHandle, fileHandle2;
+    const static FS_path filePath = FS_makePath(PATH_CHAR, "/test_file_create_delete.txt");
+    const static FS_path filePath2 = FS_makePath(PATH_CHAR, "/test_file_create_2.txt");
+    
+    if (!fixed_size) {
+        // Create file with OpenFile (not interested in opening the handle)
+        SoftAssert(FSUSER_OpenFile(NULL, &fileHandle, archive, filePath, FS_OPEN_CREATE | FS_OPEN_WRITE, 0) == 0);
+        FSFILE_Close(fileHandle);
+
+        // Make sure the new file exists
+        SoftAssert(FSUSER_OpenFile(NULL, &fileHandle, archive, filePath, FS_OPEN_READ, 0) == 0);
+        FSFILE_Close(fileHandle);
+
+        SoftAssert(FSUSER_DeleteFile(NULL, archive, filePath) == 0);
+
+        // Should fail to make sure the file no longer exists
+        SoftAssert(FSUSER_OpenFile(NULL, &fileHandle, archive, filePath, FS_OPEN_READ, 0) != 0);
+        FSFILE_Close(fileHandle);
+    }
+    
+    // Create file with CreateFile
+    SoftAssert(FSUSER_CreateFile(NULL, archive, filePath2, 0) == 0);
+    SCOPE_EXIT({
+        FSFILE_Close(fileHandle2);
+        FSUSER_DeleteFile(NULL, archive, filePath2);
+    });
+    
+    // Make sure the new file exists
+    SoftAssert(FSUSER_OpenFile(NULL, &fileHandle2, archive, filePath2, FS_OPEN_READ, 0) == 0);
+    
+    // Try and create a file over an already-existing file (Should fail)
+    SoftAssert(FSUSER_CreateFile(NULL, archive, filePath2, 0) != 0);
+
+    return true;
+}
+
+static bool TestFileRename(FS_archive archive)
+{
+    Handle fileHandle;
+    const static FS_path filePath = FS_makePath(PATH_CHAR, "/test_file_rename.txt");
+    const static FS_path newFilePath = FS_makePath(PATH_CHAR, "/test_file_rename_new.txt");
+    
+    // Create file
+    FSUSER_CreateFile(NULL, archive, filePath, 0);
+    
+    SoftAssert(FSUSER_RenameFile(NULL, archive, filePath, archive, newFilePath) == 0);
+    
+    // Should fail to make sure the old file no longer exists
+    if (FSUSER_OpenFile(NULL, &fileHandle, archive, filePath, FS_OPEN_READ, 0) == 0) {
+        FSUSER_DeleteFile(NULL, archive, filePath);
+        return false;
+    }
+    FSFILE_Close(fileHandle);
+    
+    // Make sure the new file exists
+    SoftAssert(FSUSER_OpenFile(NULL, &fileHandle, archive, newFilePath, FS_OPEN_READ, 0) == 0);
+    FSFILE_Close(fileHandle);
+    
+    SoftAssert(FSUSER_DeleteFile(NULL, archive, newFilePath) == 0);
+    
+    return true;
+}
+
+static bool TestFileWriteRead(FS_archive archive, bool fixed_size)
+{
+    Handle fileHandle;
+    u32 bytesWritten;
+    u32 bytesRead;
+    u64 fileSize;
+    
+    const static FS_path filePath = FS_makePath(PATH_CHAR, "/test_file_write_read.txt");
+    const static char* stringWritten = "A string\n";
+    
+    // Create file, at its final size where writes can't grow it
+    if (fixed_size) {
+        FSUSER_CreateFile(NULL, archive, filePath, strlen(stringWritten)+1);
+        FSUSER_OpenFile(NULL, &fileHandle, archive, filePath, FS_OPEN_READ | FS_OPEN_WRITE, 0);
+    } else {
+        FSUSER_OpenFile(NULL, &fileHandle, archive, filePath, FS_OPEN_CREATE | FS_OPEN_WRITE, 0);
+    }
+    SCOPE_EXIT({ // Close and delete file no matter what happens
+        FSFILE_Close(fileHandle);
+        FSUSER_DeleteFile(NULL, archive, filePath);
+    });
+    
+    // Write to file
+    SoftAssert(FSFILE_Write(fileHandle, &bytesWritten, 0, stringWritten, strlen(stringWritten)+1, FS_WRITE_FLUSH) == 0);
+    // Verify string size
+    SoftAssert(strlen(stringWritten)+1 == bytesWritten);
+
+    // Check file size
+    SoftAssert(FSFILE_GetSize(fileHandle, &fileSize) == 0);
+    // Verify file size
+    SoftAssert(fileSize == bytesWritten);
+    
+    std::unique_ptr<char[]> stringRead(new char[fileSize]);
+    // Read from file
+    SoftAssert(FSFILE_Read(fileHandle, &bytesRead, 0, stringRead.get(), fileSize) == 0);
+    // Verify string contents
+    SoftAssert(strcmp(stringRead.get(), stringWritten) == 0);
+    
+    return true;
+}
+
+static bool TestDirCreateDelete(FS_archive archive)
+{
+    Handle dirHandle;
+    const static FS_path dirPath = FS_makePath(PATH_CHAR, "/test_dir_create_delete");
+    
+    // Create directory
+    SoftAssert(FSUSER_CreateDirectory(NULL, archive, dirPath) == 0);
+    
+    // Make sure the new dir exists
+    SoftAssert(FSUSER_OpenDirectory(NULL, &dirHandle, archive, dirPath) == 0);
+    FSDIR_Close(dirHandle);
+    
+    SoftAssert(FSUSER_DeleteDirectory(NULL, archive, dirPath) == 0);
+    
+    // Should fail to make sure the dir no longer exists
+    SoftAssert(FSUSER_OpenDirectory(NULL, &dirHandle, archive, dirPath) != 0);
+    FSDIR_Close(dirHandle);
+    
+    return true;
+}
+
+static bool TestDirRename(FS_archive archive)
+{
+    Handle dirHandle;
+    const static FS_path dirPath = FS_makePath(PATH_CHAR, "/test_dir_rename");
+    const static FS_path newDirPath = FS_makePath(PATH_CHAR, "/test_dir_rename_new");
+    
+    // Create dir
+    FSUSER_CreateDirectory(NULL, archive, dirPath);
+    
+    SoftAssert(FSUSER_RenameDirectory(NULL, archive, dirPath, archive, newDirPath) == 0);
+    
+    // Should fail to make sure the old dir no longer exists
+    if (FSUSER_OpenDirectory(NULL, &dirHandle, archive, dirPath) == 0) {
+        FSUSER_DeleteDirectory(NULL, archive, dirPath);
+        return false;
+    }
+    FSDIR_Close(dirHandle);
+    
+    // Make sure the new dir exists
+    SoftAssert(FSUSER_OpenDirectory(NULL, &dirHandle, archive, newDirPath) == 0);
+    FSDIR_Close(dirHandle);
+    
+    SoftAssert(FSUSER_DeleteDirectory(NULL, archive, newDirPath) == 0);
+    
+    return true;
+}
+
+// Binary path of the RomFS image itself in the SelfNCCH archive
+static const u32 romfs_file_path[3] = { 0, 0, 0 };
+
+static FS_path GetBenchFilePath(const ArchiveInfo& info)
+{
+    if (!(info.flags & ARCHIVE_WRITABLE))
+        return { PATH_BINARY, sizeof(romfs_file_path), (u8*) romfs_file_path };
+    return FS_makePath(PATH_CHAR, "/test_archive_bench.bin");
+}
+
+/// Megabytes per second of the fastest of BENCH_PASSES passes over `size` bytes in `chunk` sized
+/// requests, written if `write` is set and read otherwise.
+static bool BenchSequential(Handle fileHandle, u32 size, u32 chunk, bool write, float* mib_per_second)
+{
+    static u8 buffer[64 * 1024];
+
+    Benchmark::Samples samples;
+    for (int pass = 0; pass < BENCH_PASSES; pass++) {
+        Benchmark::Timer timer;
+        for (u32 offset = 0; offset < size; offset += chunk) {
+            u32 length = std::min(chunk, size - offset);
+            u32 transferred;
+            if (write) {
+                u32 flags = (offset + length == size) ? FS_WRITE_FLUSH : 0;
+                SoftAssert(FSFILE_Write(fileHandle, &transferred, offset, buffer, length, flags) == 0);
+            } else {
+                SoftAssert(FSFILE_Read(fileHandle, &transferred, offset, buffer, length) == 0);
+            }
+            SoftAssert(transferred == length);
+        }
+        samples.Add(timer.Elapsed());
+    }
+    *mib_per_second = Benchmark::MiBPerSecond(size, samples.min);
+    return true;
+}
+
+/// Results of one archive, as table cells
+struct ArchiveResults {
+    std::string checks[NUM_CHECKS];
+    std::string throughput[NUM_DIRECTIONS][NUM_CHUNK_SIZES];
+};
+
+static void TestArchive(const ArchiveInfo& info, ArchiveResults* results)
+{
+    const std::string tag = info.name;
+    FS_archive archive = { info.id, info.path };
+
+    auto result_cell = [](bool passed) { return std::string(passed ? "ok" : "FAIL"); };
+    const bool fixed_size = (info.flags & ARCHIVE_FIXED_SIZE) != 0;
+
+    if ((info.flags & ARCHIVE_NEEDS_EXTDATA_ID) && !HAVE_EXTDATA_ID) {
+        Log(GFX_TOP, Common::FormatString("%s: not available (no EXTDATA_ID), skipped\n", info.name));
+        return;
+    }
+
+    if (info.flags & ARCHIVE_REQUIRED) {
+        if (!Test(tag, "Opening archive", [&]{ return FSUSER_OpenArchive(NULL, &archive); }, 0L))
+            return;
+    } else {
+        Result res = FSUSER_OpenArchive(NULL, &archive);
+        if (res != 0) {
+            Log(GFX_TOP, Common::FormatString("%s: not available (%08X), skipped\n", info.name, (unsigned)res));
+            return;
+        }
+    }
+
+    if (info.flags & ARCHIVE_WRITABLE) {
+        results->checks[CHECK_FILE_CREATE_DELETE] = result_cell(Test(tag, "Creating and deleting file", [&]{ return TestFileCreateDelete(archive, fixed_size); }, true));
+        results->checks[CHECK_FILE_RENAME] = result_cell(Test(tag, "Renaming file", [&]{ return TestFileRename(archive); }, true));
+        results->checks[CHECK_FILE_WRITE_READ] = result_cell(Test(tag, "Writing and reading file", [&]{ return TestFileWriteRead(archive, fixed_size); }, true));
+        results->checks[CHECK_DIR_CREATE_DELETE] = result_cell(Test(tag, "Creating and deleting directory", [&]{ return TestDirCreateDelete(archive); }, true));
+        results->checks[CHECK_DIR_RENAME] = result_cell(Test(tag, "Renaming directory", [&]{ return TestDirRename(archive); }, true));
+    }
+
+    FS_path benchPath = GetBenchFilePath(info);
+    Handle fileHandle = 0;
+    u64 fileSize = 0;
+    bool opened = Test(tag, "Opening benchmark file", [&] {
+        u32 openFlags = FS_OPEN_READ;
+        if (info.flags & ARCHIVE_WRITABLE) {
+            FSUSER_DeleteFile(NULL, archive, benchPath);
+            SoftAssert(FSUSER_CreateFile(NULL, archive, benchPath, BENCH_FILE_SIZE) == 0);
+            openFlags |= FS_OPEN_WRITE;
+        }
+        if (FSUSER_OpenFile(NULL, &fileHandle, archive, benchPath, openFlags, 0) != 0) {
+            fileHandle = 0;
+            return false;
+        }
+        return FSFILE_GetSize(fileHandle, &fileSize) == 0;
+    }, true);
+
+    if (opened) {
+        u32 size = (u32)std::min<u64>(fileSize, BENCH_FILE_SIZE);
+        for (int write = 1; write >= 0; write--) {
+            if (write && !(info.flags & ARCHIVE_WRITABLE))
+                continue;
+
+            Direction direction = write ? DIRECTION_WRITE : DIRECTION_READ;
+            for (u32 i = 0; i < NUM_CHUNK_SIZES; i++) {
+                u32 chunk = BENCH_CHUNK_SIZES[i];
+                float mib_per_second = 0.0f;
+                std::string name = Common::FormatString("Sequential %s, %s chunks", write ? "write" : "read",
+                                                        Benchmark::FormatSize(chunk).c_str());
+                if (Test(tag, name, [&] { return BenchSequential(fileHandle, size, chunk, write, &mib_per_second); }, true))
+                    results->throughput[direction][i] = Common::FormatString("%.2f", mib_per_second);
+                else
+                    results->throughput[direction][i] = "FAIL";
+            }
+        }
+    }
+    // Also closed when only the size query failed
+    if (fileHandle)
+        FSFILE_Close(fileHandle);
+    if (info.flags & ARCHIVE_WRITABLE)
+        FSUSER_DeleteFile(NULL, archive, benchPath);
+
+    if (info.flags & ARCHIVE_REQUIRED)
+        Test(tag, "Closing archive", [&]{ return FSUSER_CloseArchive(NULL, &archive); }, 0L);
+    else
+        FSUSER_CloseArchive(NULL, &archive);
+}
+
+void TestAll()
+{
+    ArchiveResults results[NUM_ARCHIVES];
+    for (u32 i = 0; i < NUM_ARCHIVES; i++) {
+        for (std::string& cell : results[i].checks)
+            cell = "-";
+        for (auto& row : results[i].throughput) {
+            for (std::string& cell : row)
+                cell = "-";
+        }
+        TestArchive(ARCHIVES[i], &results[i]);
+    }
+
+    // A column per archive
+    auto columns = [](const char* first) {
+        std::vector<std::string> cells = { first };
+        for (const ArchiveInfo& info : ARCHIVES)
+            cells.push_back(info.name);
+        return cells;
+    };
+
+    Benchmark::Table checks("Archive checks", columns("Check"));
+    for (u32 c = 0; c < NUM_CHECKS; c++) {
+        std::vector<std::string> row = { CHECK_NAMES[c] };
+        for (const ArchiveResults& result : results)
+            row.push_back(result.checks[c]);
+        checks.AddRow(row);
+    }
+    checks.Log();
+
+    Benchmark::Table throughput("Archive throughput (MiB/s)", columns("Operation"));
+    for (u32 direction = 0; direction < NUM_DIRECTIONS; direction++) {
+        for (u32 i = 0; i < NUM_CHUNK_SIZES; i++) {
+            std::vector<std::string> row = {
+                Common::FormatString("%s %s", direction == DIRECTION_WRITE ? "Write" : "Read",
+                                     Benchmark::FormatSize(BENCH_CHUNK_SIZES[i]).c_str())
+            };
+            for (const ArchiveResults& result : results)
+                row.push_back(result.throughput[direction][i]);
+            throughput.AddRow(row);
+        }
+    }
+    throughput.Log();
+}
+
+} // namespace
+} // namespace
@@ -0,0 +1,11 @@
+#pragma once
+
+namespace FS {
+namespace Archives {
+
+/// Runs the file and directory checks and the throughput benchmarks on every archive type the
+/// app can open, and reports the archives side by side.
+void TestAll();
+
+}
+}
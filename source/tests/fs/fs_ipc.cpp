@@ -0,0 +1,133 @@
+#include <cstring>
+#include <functional>
+#include <string>
+
+#include <3ds.h>
+
+#include "common/scope_exit.h"
+#include "tests/benchmark.h"
+#include "tests/test.h"
+#include "tests/fs/fs_ipc.h"
+
+namespace FS {
+namespace IPC {
+
+static const int ITERATIONS = 200;
+static const u32 FILE_SIZE = 4096;
+
+// FSFILE GetSize, the cheapest request a file session answers without touching storage
+static const u32 CMD_FILE_GET_SIZE = 0x08040000;
+
+static bool BenchGetSize(Handle fileHandle, Benchmark::Samples* samples)
+{
+    for (int i = 0; i < ITERATIONS; i++) {
+        u64 size;
+        Benchmark::Timer timer;
+        Result res = FSFILE_GetSize(fileHandle, &size);
+        samples->Add(timer.Elapsed());
+        SoftAssert(res == 0 && size == FILE_SIZE);
+    }
+    return true;
+}
+
+// The same request built by hand, to separate the kernel round trip from the library wrapper
+static bool BenchRawRequest(Handle fileHandle, Benchmark::Samples* samples)
+{
+    for (int i = 0; i < ITERATIONS; i++) {
+        u32* cmdbuf = getThreadCommandBuffer();
+        cmdbuf[0] = CMD_FILE_GET_SIZE;
+
+        Benchmark::Timer timer;
+        Result res = svcSendSyncRequest(fileHandle);
+        samples->Add(timer.Elapsed());
+        SoftAssert(res == 0 && cmdbuf[1] == 0);
+    }
+    return true;
+}
+
+static bool BenchArchiveChurn(Benchmark::Samples* samples)
+{
+    for (int i = 0; i < ITERATIONS; i++) {
+        FS_archive archive = { 0x00000009, { PATH_EMPTY, 1, (u8*) "" } };
+
+        Benchmark::Timer timer;
+        Result open_res = FSUSER_OpenArchive(NULL, &archive);
+        Result close_res = FSUSER_CloseArchive(NULL, &archive);
+        samples->Add(timer.Elapsed());
+        SoftAssert(open_res == 0 && close_res == 0);
+    }
+    return true;
+}
+
+static bool BenchFileChurn(FS_archive sdmcArchive, FS_path filePath, Benchmark::Samples* samples)
+{
+    for (int i = 0; i < ITERATIONS; i++) {
+        Handle fileHandle;
+
+        Benchmark::Timer timer;
+        Result res = FSUSER_OpenFile(NULL, &fileHandle, sdmcArchive, filePath, FS_OPEN_READ, 0);
+        if (res == 0)
+            FSFILE_Close(fileHandle);
+        samples->Add(timer.Elapsed());
+        SoftAssert(res == 0);
+    }
+    return true;
+}
+
+static bool BenchRead(Handle fileHandle, u32 size, Benchmark::Samples* samples)
+{
+    static u8 buffer[FILE_SIZE];
+    for (int i = 0; i < ITERATIONS; i++) {
+        u32 bytesRead;
+
+        Benchmark::Timer timer;
+        Result res = FSFILE_Read(fileHandle, &bytesRead, 0, buffer, size);
+        samples->Add(timer.Elapsed());
+        SoftAssert(res == 0 && bytesRead == size);
+    }
+    return true;
+}
+
+void TestAll()
+{
+    const std::string tag = "FS IPC";
+
+    FS_archive sdmcArchive = { 0x00000009, { PATH_EMPTY, 1, (u8*) "" } };
+    const static FS_path filePath = FS_makePath(PATH_CHAR, "/test_ipc_bench.bin");
+
+    if (!Test(tag, "Opening archive", [&]{ return FSUSER_OpenArchive(NULL, &sdmcArchive); }, 0L))
+        return;
+    SCOPE_EXIT({ FSUSER_CloseArchive(NULL, &sdmcArchive); });
+
+    Handle fileHandle = 0;
+    bool created = Test(tag, "Creating benchmark file", [&] {
+        static u8 contents[FILE_SIZE];
+        u32 bytesWritten;
+        SoftAssert(FSUSER_OpenFile(NULL, &fileHandle, sdmcArchive, filePath, FS_OPEN_CREATE | FS_OPEN_READ | FS_OPEN_WRITE, 0) == 0);
+        SoftAssert(FSFILE_Write(fileHandle, &bytesWritten, 0, contents, FILE_SIZE, FS_WRITE_FLUSH) == 0);
+        return bytesWritten == FILE_SIZE;
+    }, true);
+    SCOPE_EXIT({
+        FSFILE_Close(fileHandle);
+        FSUSER_DeleteFile(NULL, sdmcArchive, filePath);
+    });
+    if (!created)
+        return;
+
+    Benchmark::Table table("FS request cost per call (us)", { "Operation", "Avg", "Min", "Max" });
+    auto bench = [&](const std::string& name, std::function<bool(Benchmark::Samples*)> func) {
+        Benchmark::RunCase<Benchmark::Samples>(&table, tag, { name }, func, Benchmark::LatencyCells);
+    };
+
+    bench("Raw svcSendSyncRequest", [&](Benchmark::Samples* s) { return BenchRawRequest(fileHandle, s); });
+    bench("FSFILE_GetSize", [&](Benchmark::Samples* s) { return BenchGetSize(fileHandle, s); });
+    bench("Open+close archive", BenchArchiveChurn);
+    bench("Open+close file", [&](Benchmark::Samples* s) { return BenchFileChurn(sdmcArchive, filePath, s); });
+    bench("FSFILE_Read 1 byte", [&](Benchmark::Samples* s) { return BenchRead(fileHandle, 1, s); });
+    bench("FSFILE_Read 4K", [&](Benchmark::Samples* s) { return BenchRead(fileHandle, FILE_SIZE, s); });
+
+    table.Log();
+}
+
+} // namespace
+} // namespace
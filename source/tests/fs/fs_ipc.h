@@ -1,9 +1,9 @@
 #pragma once
 
 namespace FS {
-namespace SDMC {
-    
+namespace IPC {
+
 void TestAll();
-   
+
+}
 }
-}
\ No newline at end of file
@@ -0,0 +1,7 @@
+#pragma once
+
+namespace GPU {
+namespace Transfer {
+void TestAll();
+}
+}
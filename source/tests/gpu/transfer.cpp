@@ -0,0 +1,298 @@
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include <3ds.h>
+
+#include "common/scope_exit.h"
+#include "common/string_funcs.h"
+#include "tests/benchmark.h"
+#include "tests/test.h"
+#include "tests/gpu/gputests.h"
+
+namespace GPU {
+namespace Transfer {
+
+static const u32 TRANSFER_SIZES[] = { 16 * 1024, 64 * 1024, 256 * 1024, 1024 * 1024 };
+static const u32 MAX_SIZE = 1024 * 1024;
+static const int ITERATIONS = 8;
+
+// Display transfers treat the buffers as RGBA8 images of this width
+static const u32 IMAGE_WIDTH = 256;
+
+// Scratch buffers in the upper half of VRAM, which nothing else in this program uses
+static u8* const VRAM_SCRATCH_A = (u8*)0x1F300000;
+static u8* const VRAM_SCRATCH_B = VRAM_SCRATCH_A + MAX_SIZE;
+
+enum MemoryKind {
+    MEM_HEAP,
+    MEM_LINEAR,
+    MEM_VRAM,
+};
+
+struct Buffers {
+    u8* heap[2];
+    u8* linear[2];
+};
+
+struct Costs {
+    u64 cache;
+    u64 transfer;
+};
+
+static const char* KindName(MemoryKind kind)
+{
+    switch (kind) {
+        case MEM_HEAP:   return "heap";
+        case MEM_LINEAR: return "linear";
+        case MEM_VRAM:   return "vram";
+    }
+    return "?";
+}
+
+static u8* GetBuffer(const Buffers& buffers, MemoryKind kind, int index)
+{
+    switch (kind) {
+        case MEM_HEAP:   return buffers.heap[index];
+        case MEM_LINEAR: return buffers.linear[index];
+        case MEM_VRAM:   return index ? VRAM_SCRATCH_B : VRAM_SCRATCH_A;
+    }
+    return nullptr;
+}
+
+// VRAM is not cached by the ARM11, everything else has to be flushed before the GPU reads it
+// and invalidated before the CPU reads what the GPU wrote.
+static void FlushIfCached(MemoryKind kind, u8* buffer, u32 size)
+{
+    if (kind != MEM_VRAM)
+        GSPGPU_FlushDataCache(NULL, buffer, size);
+}
+
+static void InvalidateIfCached(MemoryKind kind, u8* buffer, u32 size)
+{
+    if (kind != MEM_VRAM)
+        GSPGPU_InvalidateDataCache(NULL, buffer, size);
+}
+
+static void FillPattern(u8* buffer, u32 size, u32 seed)
+{
+    u32* words = reinterpret_cast<u32*>(buffer);
+    for (u32 i = 0; i < size / 4; i++)
+        words[i] = (i * 0x9E3779B9) ^ seed;
+}
+
+static void TextureCopy(u8* src, u8* dst, u32 size)
+{
+    // Plain linear copy: no gaps between lines, so the line width only has to divide the size
+    u32 line = ((size < 0x1000) ? size : 0x1000) >> 4;
+    GX_SetTextureCopy(NULL, (u32*)src, GX_BUFFER_DIM(line, 0), (u32*)dst, GX_BUFFER_DIM(line, 0),
+                      size, 0x8);
+    gspWaitForEvent(GSPEVENT_PPF, false);
+}
+
+static void DisplayTransfer(u8* src, u8* dst, u32 size, bool out_tiled)
+{
+    u32 dim = GX_BUFFER_DIM(IMAGE_WIDTH, size / (IMAGE_WIDTH * 4));
+    // RGBA8 in and out; bit 1 selects linear -> tiled instead of tiled -> linear
+    GX_SetDisplayTransfer(NULL, (u32*)src, dim, (u32*)dst, dim, out_tiled ? 0x2 : 0x0);
+    gspWaitForEvent(GSPEVENT_PPF, false);
+}
+
+static void MemoryFill(u8* dst, u32 size, u32 value)
+{
+    // Fill with 32-bit values, using only the first of the two fill units
+    GX_SetMemoryFill(NULL, (u32*)dst, value, (u32*)(dst + size), 0x201, NULL, 0, NULL, 0);
+    gspWaitForEvent(GSPEVENT_PSC0, false);
+}
+
+static bool BenchTextureCopy(const Buffers& buffers, MemoryKind src_kind, MemoryKind dst_kind,
+                             u32 size, Costs* costs)
+{
+    u8* src = GetBuffer(buffers, src_kind, 0);
+    u8* dst = GetBuffer(buffers, dst_kind, 1);
+    FillPattern(src, size, size);
+    memset(dst, 0, size);
+
+    for (int i = 0; i < ITERATIONS; i++) {
+        Benchmark::Timer timer;
+        FlushIfCached(src_kind, src, size);
+        FlushIfCached(dst_kind, dst, size);
+        costs->cache += timer.Elapsed();
+
+        timer.Restart();
+        TextureCopy(src, dst, size);
+        costs->transfer += timer.Elapsed();
+
+        timer.Restart();
+        InvalidateIfCached(dst_kind, dst, size);
+        costs->cache += timer.Elapsed();
+    }
+    return memcmp(src, dst, size) == 0;
+}
+
+static bool BenchDisplayTransfer(const Buffers& buffers, MemoryKind src_kind, MemoryKind dst_kind,
+                                 u32 size, Costs* costs)
+{
+    u8* src = GetBuffer(buffers, src_kind, 0);
+    u8* dst = GetBuffer(buffers, dst_kind, 1);
+    FillPattern(src, size, size);
+
+    for (int i = 0; i < ITERATIONS; i++) {
+        Benchmark::Timer timer;
+        FlushIfCached(src_kind, src, size);
+        FlushIfCached(dst_kind, dst, size);
+        costs->cache += timer.Elapsed();
+
+        timer.Restart();
+        DisplayTransfer(src, dst, size, false);
+        costs->transfer += timer.Elapsed();
+
+        timer.Restart();
+        InvalidateIfCached(dst_kind, dst, size);
+        costs->cache += timer.Elapsed();
+    }
+
+    // Tiling the result again has to restore the source image exactly. The display transfer
+    // paths always write to linear memory, so the second VRAM buffer is free to hold it.
+    u8* check = VRAM_SCRATCH_B;
+    DisplayTransfer(dst, check, size, true);
+    return memcmp(src, check, size) == 0;
+}
+
+static bool BenchMemoryFill(const Buffers& buffers, MemoryKind dst_kind, u32 size, Costs* costs)
+{
+    u8* dst = GetBuffer(buffers, dst_kind, 1);
+    const u32 value = 0xA5C30F96;
+    memset(dst, 0, size);
+
+    for (int i = 0; i < ITERATIONS; i++) {
+        Benchmark::Timer timer;
+        FlushIfCached(dst_kind, dst, size);
+        costs->cache += timer.Elapsed();
+
+        timer.Restart();
+        MemoryFill(dst, size, value);
+        costs->transfer += timer.Elapsed();
+
+        timer.Restart();
+        InvalidateIfCached(dst_kind, dst, size);
+        costs->cache += timer.Elapsed();
+    }
+
+    const u32* words = reinterpret_cast<const u32*>(dst);
+    for (u32 i = 0; i < size / 4; i++) {
+        if (words[i] != value)
+            return false;
+    }
+    return true;
+}
+
+static bool BenchMemcpy(const Buffers& buffers, MemoryKind src_kind, MemoryKind dst_kind,
+                        u32 size, Costs* costs)
+{
+    u8* src = GetBuffer(buffers, src_kind, 0);
+    u8* dst = GetBuffer(buffers, dst_kind, 1);
+    FillPattern(src, size, size);
+
+    for (int i = 0; i < ITERATIONS; i++) {
+        Benchmark::Timer timer;
+        memcpy(dst, src, size);
+        costs->transfer += timer.Elapsed();
+
+        // Only linear memory can be handed to the GPU afterwards, and then it needs a flush
+        timer.Restart();
+        if (dst_kind == MEM_LINEAR)
+            FlushIfCached(dst_kind, dst, size);
+        costs->cache += timer.Elapsed();
+    }
+    return memcmp(src, dst, size) == 0;
+}
+
+enum Engine {
+    ENGINE_TEXTURE_COPY,
+    ENGINE_DISPLAY_TRANSFER,
+    ENGINE_MEMORY_FILL,
+    ENGINE_MEMCPY,
+};
+
+struct Path {
+    Engine engine;
+    const char* name;
+    MemoryKind src;
+    MemoryKind dst;
+};
+
+static const Path PATHS[] = {
+    { ENGINE_TEXTURE_COPY,     "TextureCopy",     MEM_LINEAR, MEM_LINEAR },
+    { ENGINE_TEXTURE_COPY,     "TextureCopy",     MEM_LINEAR, MEM_VRAM },
+    { ENGINE_TEXTURE_COPY,     "TextureCopy",     MEM_VRAM,   MEM_LINEAR },
+    { ENGINE_TEXTURE_COPY,     "TextureCopy",     MEM_VRAM,   MEM_VRAM },
+    { ENGINE_DISPLAY_TRANSFER, "DisplayTransfer", MEM_LINEAR, MEM_LINEAR },
+    { ENGINE_DISPLAY_TRANSFER, "DisplayTransfer", MEM_VRAM,   MEM_LINEAR },
+    { ENGINE_MEMORY_FILL,      "MemoryFill",      MEM_LINEAR, MEM_LINEAR },
+    { ENGINE_MEMORY_FILL,      "MemoryFill",      MEM_VRAM,   MEM_VRAM },
+    { ENGINE_MEMCPY,           "memcpy",          MEM_HEAP,   MEM_HEAP },
+    { ENGINE_MEMCPY,           "memcpy",          MEM_LINEAR, MEM_LINEAR },
+    { ENGINE_MEMCPY,           "memcpy",          MEM_LINEAR, MEM_VRAM },
+    { ENGINE_MEMCPY,           "memcpy",          MEM_VRAM,   MEM_LINEAR },
+};
+
+static bool RunPath(const Buffers& buffers, const Path& path, u32 size, Costs* costs)
+{
+    switch (path.engine) {
+        case ENGINE_TEXTURE_COPY:     return BenchTextureCopy(buffers, path.src, path.dst, size, costs);
+        case ENGINE_DISPLAY_TRANSFER: return BenchDisplayTransfer(buffers, path.src, path.dst, size, costs);
+        case ENGINE_MEMORY_FILL:      return BenchMemoryFill(buffers, path.dst, size, costs);
+        case ENGINE_MEMCPY:           return BenchMemcpy(buffers, path.src, path.dst, size, costs);
+    }
+    return false;
+}
+
+void TestAll()
+{
+    const std::string tag = "GX";
+
+    Buffers buffers = {};
+    SCOPE_EXIT({
+        for (int i = 0; i < 2; i++) {
+            free(buffers.heap[i]);
+            linearFree(buffers.linear[i]);
+        }
+    });
+    for (int i = 0; i < 2; i++) {
+        buffers.heap[i] = static_cast<u8*>(malloc(MAX_SIZE));
+        buffers.linear[i] = static_cast<u8*>(linearMemAlign(MAX_SIZE, 0x80));
+    }
+
+    bool allocated = buffers.heap[0] && buffers.heap[1] && buffers.linear[0] && buffers.linear[1];
+    if (!Test(tag, "Allocating buffers", allocated, true))
+        return;
+
+    Benchmark::Table table("GX transfer cost per call (us) and rate incl. cache ops",
+                           { "Path", "Size", "Cache", "Xfer", "MiB/s" });
+
+    for (const Path& path : PATHS) {
+        std::string name = Common::FormatString("%s %s->%s", path.name, KindName(path.src), KindName(path.dst));
+        if (path.engine == ENGINE_MEMORY_FILL)
+            name = Common::FormatString("%s %s", path.name, KindName(path.dst));
+
+        Test(tag, name, [&] {
+            bool correct = true;
+            for (u32 size : TRANSFER_SIZES) {
+                Costs costs = {};
+                correct &= RunPath(buffers, path, size, &costs);
+                table.AddRow({ name, Benchmark::FormatSize(size),
+                               Benchmark::FormatMicroseconds(costs.cache / ITERATIONS),
+                               Benchmark::FormatMicroseconds(costs.transfer / ITERATIONS),
+                               Common::FormatString("%.1f", Benchmark::MiBPerSecond(
+                                   (u64)size * ITERATIONS, costs.cache + costs.transfer)) });
+            }
+            return correct;
+        }, true);
+    }
+
+    table.Log();
+}
+
+} // namespace
+} // namespace
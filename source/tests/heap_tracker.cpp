@@ -0,0 +1,233 @@
+#include "tests/heap_tracker.h"
+
+#include <malloc.h>
+
+// Entry points of newlib's allocator and of ctrulib's linear heap. The linker redirects calls to
+// them here, and the original versions stay reachable as __real_*.
+extern "C" {
+void* __real__malloc_r(struct _reent* reent, size_t size);
+void* __real__calloc_r(struct _reent* reent, size_t count, size_t size);
+void* __real__realloc_r(struct _reent* reent, void* block, size_t size);
+void* __real__memalign_r(struct _reent* reent, size_t alignment, size_t size);
+void __real__free_r(struct _reent* reent, void* block);
+
+void* __real_linearAlloc(size_t size);
+void* __real_linearMemAlign(size_t size, size_t alignment);
+void __real_linearFree(void* block);
+}
+
+namespace HeapTracker {
+
+namespace {
+
+struct ThreadRecord {
+    void* tls;          ///< Thread local storage address of the owning thread, which identifies it
+    u32 depth;          ///< Nesting of allocator calls, as realloc and friends call malloc and free
+    bool tracking;
+    CaseStats stats;
+};
+
+struct LinearBlock {
+    void* block;
+    size_t size;
+};
+
+}
+
+// Enough for every thread the tests run at once. Threads that do not get a record are only
+// counted in the totals.
+static ThreadRecord thread_records[16];
+static CaseStats totals;
+
+// ctrulib has no way to ask for the size of a linear block, so it is remembered here. Linear
+// allocations are few and large, and blocks that do not fit are simply not counted.
+static LinearBlock linear_blocks[64];
+
+static ThreadRecord* GetThreadRecord()
+{
+    void* tls = getThreadLocalStorage();
+    for (ThreadRecord& record : thread_records) {
+        if (record.tls == tls)
+            return &record;
+    }
+    // The kernel reuses the storage of exited threads, so records are never released
+    for (ThreadRecord& record : thread_records) {
+        if (record.tls == nullptr && __sync_bool_compare_and_swap(&record.tls, nullptr, tls))
+            return &record;
+    }
+    return nullptr;
+}
+
+/// Returns whether this is the outermost allocator call of the thread, which is the one counted.
+static bool Enter(ThreadRecord* thread)
+{
+    return !thread || thread->depth++ == 0;
+}
+
+static void Leave(ThreadRecord* thread)
+{
+    if (thread)
+        thread->depth--;
+}
+
+static void Count(Stats* stats, s32 delta, u32 allocations)
+{
+    stats->allocations += allocations;
+    stats->net_bytes += delta;
+    if (stats->net_bytes > stats->peak_bytes)
+        stats->peak_bytes = stats->net_bytes;
+}
+
+// Totals are shared by every thread, so they are updated with exclusive loads and stores
+static void CountShared(Stats* stats, s32 delta, u32 allocations)
+{
+    __sync_fetch_and_add(&stats->allocations, allocations);
+    s32 net = __sync_add_and_fetch(&stats->net_bytes, delta);
+    s32 peak = stats->peak_bytes;
+    while (net > peak && !__sync_bool_compare_and_swap(&stats->peak_bytes, peak, net))
+        peak = stats->peak_bytes;
+}
+
+static void CountHeap(ThreadRecord* thread, s32 delta, u32 allocations)
+{
+    CountShared(&totals.heap, delta, allocations);
+    if (thread && thread->tracking)
+        Count(&thread->stats.heap, delta, allocations);
+}
+
+static void CountLinear(ThreadRecord* thread, s32 delta, u32 allocations)
+{
+    CountShared(&totals.linear, delta, allocations);
+    if (thread && thread->tracking)
+        Count(&thread->stats.linear, delta, allocations);
+}
+
+static s32 BlockSize(struct _reent* reent, void* block)
+{
+    return block ? _malloc_usable_size_r(reent, block) : 0;
+}
+
+void BeginCase()
+{
+    ThreadRecord* thread = GetThreadRecord();
+    if (!thread)
+        return;
+
+    thread->stats = CaseStats();
+    thread->tracking = true;
+}
+
+CaseStats EndCase()
+{
+    ThreadRecord* thread = GetThreadRecord();
+    if (!thread)
+        return CaseStats();
+
+    thread->tracking = false;
+    return thread->stats;
+}
+
+CaseStats GetTotals()
+{
+    return totals;
+}
+
+}
+
+using namespace HeapTracker;
+
+extern "C" {
+
+void* __wrap__malloc_r(struct _reent* reent, size_t size)
+{
+    ThreadRecord* thread = GetThreadRecord();
+    bool outermost = Enter(thread);
+    void* block = __real__malloc_r(reent, size);
+    if (outermost && block)
+        CountHeap(thread, BlockSize(reent, block), 1);
+    Leave(thread);
+    return block;
+}
+
+void* __wrap__calloc_r(struct _reent* reent, size_t count, size_t size)
+{
+    ThreadRecord* thread = GetThreadRecord();
+    bool outermost = Enter(thread);
+    void* block = __real__calloc_r(reent, count, size);
+    if (outermost && block)
+        CountHeap(thread, BlockSize(reent, block), 1);
+    Leave(thread);
+    return block;
+}
+
+void* __wrap__realloc_r(struct _reent* reent, void* block, size_t size)
+{
+    ThreadRecord* thread = GetThreadRecord();
+    bool outermost = Enter(thread);
+    s32 old_size = outermost ? BlockSize(reent, block) : 0;
+    void* new_block = __real__realloc_r(reent, block, size);
+    if (outermost && new_block)
+        CountHeap(thread, BlockSize(reent, new_block) - old_size, 1);
+    Leave(thread);
+    return new_block;
+}
+
+void* __wrap__memalign_r(struct _reent* reent, size_t alignment, size_t size)
+{
+    ThreadRecord* thread = GetThreadRecord();
+    bool outermost = Enter(thread);
+    void* block = __real__memalign_r(reent, alignment, size);
+    if (outermost && block)
+        CountHeap(thread, BlockSize(reent, block), 1);
+    Leave(thread);
+    return block;
+}
+
+void __wrap__free_r(struct _reent* reent, void* block)
+{
+    ThreadRecord* thread = GetThreadRecord();
+    bool outermost = Enter(thread);
+    if (outermost && block)
+        CountHeap(thread, -BlockSize(reent, block), 0);
+    __real__free_r(reent, block);
+    Leave(thread);
+}
+
+static void* RecordLinearBlock(void* block, size_t size)
+{
+    if (!block)
+        return block;
+
+    for (LinearBlock& entry : linear_blocks) {
+        if (entry.block == nullptr && __sync_bool_compare_and_swap(&entry.block, nullptr, block)) {
+            entry.size = size;
+            CountLinear(GetThreadRecord(), size, 1);
+            break;
+        }
+    }
+    return block;
+}
+
+void* __wrap_linearAlloc(size_t size)
+{
+    return RecordLinearBlock(__real_linearAlloc(size), size);
+}
+
+void* __wrap_linearMemAlign(size_t size, size_t alignment)
+{
+    return RecordLinearBlock(__real_linearMemAlign(size, alignment), size);
+}
+
+void __wrap_linearFree(void* block)
+{
+    for (LinearBlock& entry : linear_blocks) {
+        if (block && entry.block == block) {
+            CountLinear(GetThreadRecord(), -(s32)entry.size, 0);
+            entry.block = nullptr;
+            break;
+        }
+    }
+    __real_linearFree(block);
+}
+
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <3ds.h>
+
+namespace HeapTracker {
+
+/// Allocator activity over some span of time
+struct Stats {
+    u32 allocations;    ///< Blocks allocated or resized
+    s32 net_bytes;      ///< Bytes allocated minus bytes freed; positive once the span ends is a leak
+    s32 peak_bytes;     ///< Highest net_bytes reached during the span
+};
+
+struct CaseStats {
+    Stats heap;         ///< malloc, new and everything built on them
+    Stats linear;       ///< linearAlloc and linearMemAlign
+};
+
+/**
+ * Starts counting the calling thread's allocations for a test case. The counters hook the
+ * allocator itself (see the --wrap flags in the Makefile), so they also see allocations made by
+ * newlib and ctrulib on behalf of the case.
+ */
+void BeginCase();
+
+/// Stops counting the calling thread's allocations and returns what the case did.
+CaseStats EndCase();
+
+/// Returns the allocations of every thread since startup; net_bytes is the live total.
+CaseStats GetTotals();
+
+}
@@ -0,0 +1,7 @@
+#pragma once
+
+namespace Kernel {
+namespace Threading {
+void TestAll();
+}
+}
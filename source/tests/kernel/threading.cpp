@@ -0,0 +1,234 @@
+#include <functional>
+#include <string>
+
+#include <3ds.h>
+
+#include "common/scope_exit.h"
+#include "common/string_funcs.h"
+#include "common/thread.h"
+#include "common/timer.h"
+#include "tests/benchmark.h"
+#include "tests/test.h"
+#include "tests/kernel/kerneltests.h"
+
+namespace Kernel {
+namespace Threading {
+
+static const int CREATE_ITERATIONS = 100;
+static const int ROUND_TRIPS = 1000;
+static const int SLEEP_ITERATIONS = 20;
+
+// RESET_ONESHOT: a wait consumes the signal
+static const u8 EVENT_ONESHOT = 0;
+
+static u32 empty_thread_stack[0x400] __attribute__((aligned(8)));
+
+static void EmptyThreadEntry(u32 arg)
+{
+    svcExitThread();
+}
+
+// Thread creation and join through the raw SVCs, reusing one stack so allocation is not counted
+static bool BenchCreateJoin(s32 core, Benchmark::Samples* samples)
+{
+    s32 priority = Common::GetCurrentThreadPriority();
+    u32* stack_top = empty_thread_stack + sizeof(empty_thread_stack) / sizeof(u32);
+
+    for (int i = 0; i < CREATE_ITERATIONS; i++) {
+        Handle thread;
+        Benchmark::Timer timer;
+        if (svcCreateThread(&thread, EmptyThreadEntry, 0, stack_top, priority, core) != 0)
+            return false;
+        svcWaitSynchronization(thread, U64_MAX);
+        samples->Add(timer.Elapsed());
+        svcCloseHandle(thread);
+    }
+    return true;
+}
+
+struct EventPingPong {
+    Handle ping;
+    Handle pong;
+};
+
+static void EventPongThread(void* arg)
+{
+    EventPingPong* events = static_cast<EventPingPong*>(arg);
+    for (int i = 0; i < ROUND_TRIPS; i++) {
+        svcWaitSynchronization(events->ping, U64_MAX);
+        svcSignalEvent(events->pong);
+    }
+}
+
+static bool BenchEventPingPong(s32 core, Benchmark::Samples* samples)
+{
+    EventPingPong events = {};
+    if (svcCreateEvent(&events.ping, EVENT_ONESHOT) != 0 || svcCreateEvent(&events.pong, EVENT_ONESHOT) != 0)
+        return false;
+    SCOPE_EXIT({
+        svcCloseHandle(events.ping);
+        svcCloseHandle(events.pong);
+    });
+
+    Common::Thread thread(EventPongThread, &events, Common::GetCurrentThreadPriority(), core);
+    if (!thread.IsValid())
+        return false;
+
+    for (int i = 0; i < ROUND_TRIPS; i++) {
+        Benchmark::Timer timer;
+        svcSignalEvent(events.ping);
+        svcWaitSynchronization(events.pong, U64_MAX);
+        samples->Add(timer.Elapsed());
+    }
+    return true;
+}
+
+// Hand-off through an address arbiter, the primitive user-mode light locks fall back to. Both
+// sides bump a shared sequence number and sleep until the other side has bumped it again.
+struct ArbiterPingPong {
+    Handle arbiter;
+    volatile s32 sequence;
+};
+
+static void WaitForSequence(ArbiterPingPong* state, s32 value)
+{
+    while (state->sequence < value)
+        svcArbitrateAddress(state->arbiter, (u32)(uintptr_t)&state->sequence, ARBITRATION_WAIT_IF_LESS_THAN, value, 0);
+}
+
+static void AdvanceSequence(ArbiterPingPong* state, s32 value)
+{
+    state->sequence = value;
+    __sync_synchronize();
+    svcArbitrateAddress(state->arbiter, (u32)(uintptr_t)&state->sequence, ARBITRATION_SIGNAL, 1, 0);
+}
+
+static void ArbiterPongThread(void* arg)
+{
+    ArbiterPingPong* state = static_cast<ArbiterPingPong*>(arg);
+    for (int i = 0; i < ROUND_TRIPS; i++) {
+        WaitForSequence(state, 2 * i + 1);
+        AdvanceSequence(state, 2 * i + 2);
+    }
+}
+
+static bool BenchArbiterPingPong(s32 core, Benchmark::Samples* samples)
+{
+    ArbiterPingPong state = {};
+    if (svcCreateAddressArbiter(&state.arbiter) != 0)
+        return false;
+    SCOPE_EXIT({ svcCloseHandle(state.arbiter); });
+
+    Common::Thread thread(ArbiterPongThread, &state, Common::GetCurrentThreadPriority(), core);
+    if (!thread.IsValid())
+        return false;
+
+    for (int i = 0; i < ROUND_TRIPS; i++) {
+        Benchmark::Timer timer;
+        AdvanceSequence(&state, 2 * i + 1);
+        WaitForSequence(&state, 2 * i + 2);
+        samples->Add(timer.Elapsed());
+    }
+    return true;
+}
+
+static bool BenchMutexUncontended(Benchmark::Samples* samples)
+{
+    Handle mutex;
+    if (svcCreateMutex(&mutex, false) != 0)
+        return false;
+    SCOPE_EXIT({ svcCloseHandle(mutex); });
+
+    for (int i = 0; i < ROUND_TRIPS; i++) {
+        Benchmark::Timer timer;
+        svcWaitSynchronization(mutex, U64_MAX);
+        svcReleaseMutex(mutex);
+        samples->Add(timer.Elapsed());
+    }
+    return true;
+}
+
+// One-way latency from signalling an event to the woken thread running. The waiter has a higher
+// priority than the signaller, so on the same core it preempts it immediately.
+struct WakeLatency {
+    Handle wake;
+    Handle ack;
+    volatile u64 woke_at;
+};
+
+static void WakeThread(void* arg)
+{
+    WakeLatency* state = static_cast<WakeLatency*>(arg);
+    for (int i = 0; i < ROUND_TRIPS; i++) {
+        svcWaitSynchronization(state->wake, U64_MAX);
+        state->woke_at = svcGetSystemTick();
+        svcSignalEvent(state->ack);
+    }
+}
+
+static bool BenchWakeLatency(s32 core, Benchmark::Samples* samples)
+{
+    WakeLatency state = {};
+    if (svcCreateEvent(&state.wake, EVENT_ONESHOT) != 0 || svcCreateEvent(&state.ack, EVENT_ONESHOT) != 0)
+        return false;
+    SCOPE_EXIT({
+        svcCloseHandle(state.wake);
+        svcCloseHandle(state.ack);
+    });
+
+    Common::Thread thread(WakeThread, &state, Common::GetCurrentThreadPriority() - 1, core);
+    if (!thread.IsValid())
+        return false;
+
+    for (int i = 0; i < ROUND_TRIPS; i++) {
+        u64 signalled_at = svcGetSystemTick();
+        svcSignalEvent(state.wake);
+        svcWaitSynchronization(state.ack, U64_MAX);
+        samples->Add(state.woke_at - signalled_at);
+    }
+    return true;
+}
+
+// How late svcSleepThread wakes up compared to the requested duration
+static bool BenchSleepJitter(s64 nanoseconds, Benchmark::Samples* samples)
+{
+    u64 requested = nanoseconds * Common::TICKS_PER_SECOND / 1000000000ULL;
+    for (int i = 0; i < SLEEP_ITERATIONS; i++) {
+        Benchmark::Timer timer;
+        svcSleepThread(nanoseconds);
+        u64 elapsed = timer.Elapsed();
+        samples->Add(elapsed > requested ? elapsed - requested : 0);
+    }
+    return true;
+}
+
+void TestAll()
+{
+    const std::string tag = "Kernel";
+
+    Test(tag, "Reserving syscore time", Common::ReserveSysCoreTime, 0L);
+
+    Benchmark::Table table("Kernel primitive latency (us)", { "Operation", "Peer core", "Avg", "Min", "Max" });
+    auto bench = [&](const std::string& name, s32 core, std::function<bool(Benchmark::Samples*)> func) {
+        const char* core_name = (core == Common::CORE_APP) ? "app" : (core == Common::CORE_SYS) ? "sys" : "-";
+        Benchmark::RunCase<Benchmark::Samples>(&table, tag, { name, core_name }, func, Benchmark::LatencyCells);
+    };
+
+    for (s32 core : { Common::CORE_APP, Common::CORE_SYS }) {
+        bench("Thread create+join", core, [&](Benchmark::Samples* s) { return BenchCreateJoin(core, s); });
+        bench("Event ping-pong", core, [&](Benchmark::Samples* s) { return BenchEventPingPong(core, s); });
+        bench("Arbiter ping-pong", core, [&](Benchmark::Samples* s) { return BenchArbiterPingPong(core, s); });
+        bench("Event wake latency", core, [&](Benchmark::Samples* s) { return BenchWakeLatency(core, s); });
+    }
+
+    bench("Mutex lock+unlock", -1, BenchMutexUncontended);
+    for (s64 ns : { 100000LL, 1000000LL, 5000000LL }) {
+        bench(Common::FormatString("Sleep %lluus overshoot", (unsigned long long)(ns / 1000)), -1,
+              [&](Benchmark::Samples* s) { return BenchSleepJitter(ns, s); });
+    }
+
+    table.Log();
+}
+
+} // namespace
+} // namespace
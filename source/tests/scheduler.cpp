@@ -0,0 +1,101 @@
+#include "tests/scheduler.h"
+
+#include <vector>
+
+#include <3ds.h>
+
+#include "hud.h"
+#include "output.h"
+#include "stream.h"
+#include "common/thread.h"
+
+namespace {
+
+struct GroupRun {
+    const TestGroup* group;
+    CapturedOutput output;
+    volatile bool done;
+};
+
+struct Batch {
+    std::vector<GroupRun> runs;
+    size_t next;
+    Common::Mutex mutex;
+};
+
+}
+
+static void WorkerThread(void* arg)
+{
+    Batch* batch = static_cast<Batch*>(arg);
+    for (;;) {
+        GroupRun* run;
+        {
+            Common::LockGuard lock(batch->mutex);
+            if (batch->next == batch->runs.size())
+                return;
+            run = &batch->runs[batch->next++];
+        }
+
+        BeginCapture();
+        run->group->caller();
+        run->output = EndCapture();
+
+        __sync_synchronize();
+        run->done = true;
+    }
+}
+
+static void RunBatch(const TestGroup* groups, size_t count)
+{
+    Batch batch;
+    batch.next = 0;
+    for (size_t i = 0; i < count; i++)
+        batch.runs.push_back({ &groups[i], {}, false });
+
+    // Workers run below the calling thread's priority so the screens keep updating
+    s32 priority = Common::GetCurrentThreadPriority() + 1;
+    Common::Thread app_worker(WorkerThread, &batch, priority, Common::CORE_APP);
+    Common::Thread sys_worker(WorkerThread, &batch, priority, Common::CORE_SYS);
+
+    if (!app_worker.IsValid() && !sys_worker.IsValid()) {
+        // No threads available; run the batch here instead
+        WorkerThread(&batch);
+    }
+
+    // Replay finished groups as soon as everything before them has been replayed
+    size_t replayed = 0;
+    while (replayed < count) {
+        if (batch.runs[replayed].done) {
+            __sync_synchronize();
+            ReplayOutput(batch.runs[replayed].output);
+            FlushLog();
+            replayed++;
+            continue;
+        }
+        DrawBuffers();
+        Stream::Flush();
+        HUD::WaitForVBlank();
+    }
+}
+
+void RunTestGroups(const TestGroup* groups, size_t count)
+{
+    Common::ReserveSysCoreTime();
+
+    size_t i = 0;
+    while (i < count) {
+        if (!groups[i].parallel_safe) {
+            groups[i].caller();
+            FlushLog();
+            i++;
+            continue;
+        }
+
+        size_t end = i;
+        while (end < count && groups[end].parallel_safe)
+            end++;
+        RunBatch(&groups[i], end - i);
+        i = end;
+    }
+}
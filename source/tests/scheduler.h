@@ -0,0 +1,13 @@
+#pragma once
+
+#include <cstddef>
+
+#include "tests/test.h"
+
+/**
+ * Runs `groups` in order. Consecutive parallel-safe groups form a batch that is spread over
+ * worker threads on the app core and the syscore, while the calling thread keeps the screens
+ * updated; every other group runs alone on the calling thread. Output of batched groups is
+ * captured and replayed in group order, so the logs match a sequential run.
+ */
+void RunTestGroups(const TestGroup* groups, size_t count);
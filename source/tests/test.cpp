@@ -3,15 +3,65 @@
 #include <3ds.h>
 
 #include "output.h"
+#include "results_board.h"
 #include "common/string_funcs.h"
+#include "tests/heap_tracker.h"
+#include "tests/watchdog.h"
 
-void SoftAssertLog(const std::string& function, int line, const std::string& condition)
+void SoftAssertLog(const char* function, int line, const char* condition)
 {
-    LogToFile(Common::FormatString("SOFTASSERT FAILURE: `%s`\n", condition.c_str()));
-    LogToFile(Common::FormatString("    At `%s` L%i\n", function.c_str(), line));
+    LogError("SOFTASSERT FAILURE: `%s`\n    At `%s` L%i\n", condition, function, line);
+}
+
+bool BeginTestCase(const std::string& group, const std::string& name, u32 budget_ms)
+{
+    if (Watchdog::IsGroupAborted(group)) {
+        ResultsBoard::SetCaseState(group, name, ResultsBoard::CELL_SKIPPED);
+        Log(GFX_TOP, Common::FormatString("SKIPPED: [%s] %s\n", group.c_str(), name.c_str()));
+        return false;
+    }
+
+    ResultsBoard::SetCaseState(group, name, ResultsBoard::CELL_RUNNING);
+    if (ResultsBoard::IsEnabled() && !IsCapturing())
+        DrawBuffers();
+
+    Watchdog::BeginCase(group, name, budget_ms);
+    // Last, so only the case itself is counted
+    HeapTracker::BeginCase();
+    return true;
+}
+
+bool EndTestCase(const std::string& group, const std::string& name, HeapTracker::CaseStats* memory)
+{
+    *memory = HeapTracker::EndCase();
+    if (!Watchdog::EndCase())
+        return true;
+
+    ResultsBoard::SetCaseState(group, name, ResultsBoard::CELL_FAIL);
+    Log(GFX_TOP, Common::FormatString("TIMEOUT: [%s] %s\n", group.c_str(), name.c_str()));
+    return false;
 }
 
 void PrintSuccess(const std::string& group, const std::string& name, bool val)
 {
+    ResultsBoard::SetCaseState(group, name, val ? ResultsBoard::CELL_PASS : ResultsBoard::CELL_FAIL);
     Log(GFX_TOP, Common::FormatString("%s: [%s] %s\n", val ? "SUCCESS" : "FAILURE", group.c_str(), name.c_str()));
 }
+
+void LogTestCaseMemory(const std::string& group, const std::string& name,
+                       const HeapTracker::CaseStats& memory)
+{
+    // The line is built in pieces, so this stands in for the check LogInfo makes
+    if (LOG_LEVEL_INFO < LOG_MIN_LEVEL || !IsLogLevelEnabled(LOG_LEVEL_INFO))
+        return;
+
+    std::string line = Common::FormatString("MEMORY: [%s] %s: peak %d B, %u allocations, net %d B",
+                                            group.c_str(), name.c_str(), (int)memory.heap.peak_bytes,
+                                            (unsigned)memory.heap.allocations, (int)memory.heap.net_bytes);
+    if (memory.linear.allocations != 0) {
+        line += Common::FormatString("; linear peak %d B, %u allocations, net %d B",
+                                     (int)memory.linear.peak_bytes, (unsigned)memory.linear.allocations,
+                                     (int)memory.linear.net_bytes);
+    }
+    LogMessage(LOG_LEVEL_INFO, line + "\n");
+}
@@ -2,9 +2,22 @@
 
 #include <string>
 
+#include "tests/heap_tracker.h"
+#include "tests/watchdog.h"
+
 typedef void (*TestCaller)(void);
 
-void SoftAssertLog(const std::string& function, int line, const std::string& condition);
+struct TestGroup {
+    TestCaller caller;
+
+    // Whether the group may run on a worker thread alongside other parallel-safe groups. Groups
+    // that measure timings or use the GPU must run alone.
+    bool parallel_safe;
+};
+
+/// Logs a failed SoftAssert as an error. Takes the literals the macro has, so nothing is built
+/// unless the error is logged.
+void SoftAssertLog(const char* function, int line, const char* condition);
 
 // If the condition fails, return false
 #define SoftAssert(cond) \
@@ -15,6 +28,21 @@ void SoftAssertLog(const std::string& function, int line, const std::string& con
         } \
     } while (0)
 
+/**
+ * Marks the test case `name` of `group` as running and starts the watchdog and the heap counters
+ * on it. Returns false if the case should be skipped because an earlier case of the group timed
+ * out.
+ */
+bool BeginTestCase(const std::string& group, const std::string& name, u32 budget_ms);
+
+/// Stops the watchdog and the heap counters on the running case, storing what it allocated in
+/// `memory`. Returns false, after logging a TIMEOUT, if the case ran past its budget.
+bool EndTestCase(const std::string& group, const std::string& name, HeapTracker::CaseStats* memory);
+
+/// Logs the allocations of a case after its result: peak and leaked bytes, and allocation count.
+void LogTestCaseMemory(const std::string& group, const std::string& name,
+                       const HeapTracker::CaseStats& memory);
+
 void PrintSuccess(const std::string& group, const std::string& name, bool val);
 
 template <typename T>
@@ -23,3 +51,25 @@ bool Test(const std::string& group, const std::string& name, T result, T expecte
     PrintSuccess(group, name, result == expected);
     return result == expected;
 }
+
+/**
+ * Runs `func` as a test case, so the harness knows when the case starts as well as its result.
+ * A case that takes longer than `budget_ms` fails with a TIMEOUT, and aborts the rest of its group.
+ * The memory the case allocated is logged after its result.
+ */
+template <typename Func, typename T>
+bool Test(const std::string& group, const std::string& name, Func func, T expected,
+          u32 budget_ms = Watchdog::DEFAULT_BUDGET_MS)
+{
+    if (!BeginTestCase(group, name, budget_ms))
+        return false;
+
+    T result = func();
+    HeapTracker::CaseStats memory;
+    if (!EndTestCase(group, name, &memory))
+        return false;
+
+    bool passed = Test(group, name, result, expected);
+    LogTestCaseMemory(group, name, memory);
+    return passed;
+}
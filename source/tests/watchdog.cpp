@@ -0,0 +1,163 @@
+#include "tests/watchdog.h"
+
+#include <set>
+#include <vector>
+
+#include "output.h"
+#include "common/string_funcs.h"
+#include "common/thread.h"
+#include "common/timer.h"
+
+namespace Watchdog {
+
+// How often the monitor checks the running cases
+static const u64 POLL_INTERVAL_NS = 100 * 1000 * 1000;
+// Time past its budget after which a case is considered hung
+static const u64 HANG_GRACE_MS = 10000;
+// How long the monitor waits for the log. A hung case may be holding it, and the monitor must
+// still get to end the run.
+static const u64 LOG_TIMEOUT_NS = 500 * 1000 * 1000;
+
+namespace {
+
+struct RunningCase {
+    u32 thread_id;
+    std::string group;
+    std::string name;
+    u64 start;
+    u64 deadline;
+    u64 hang_deadline;
+    bool timed_out;
+    bool noted;     ///< Whether the late note reached the log
+};
+
+}
+
+static Common::Mutex watchdog_mutex;
+static std::vector<RunningCase> running_cases;
+static std::set<std::string> aborted_groups;
+
+static Handle stop_event;
+static Common::Thread* monitor;
+
+static u64 MillisecondsToTicks(u64 ms)
+{
+    return ms * Common::TICKS_PER_SECOND / 1000;
+}
+
+static u32 GetCurrentThreadId()
+{
+    u32 thread_id = 0;
+    svcGetThreadId(&thread_id, CUR_THREAD_HANDLE);
+    return thread_id;
+}
+
+static void CheckCases()
+{
+    // Output is written after watchdog_mutex is released, as the thread holding the log may be
+    // waiting for it
+    std::vector<std::string> notes;
+    std::string abort_line;
+    {
+        Common::LockGuard lock(watchdog_mutex);
+
+        u64 now = svcGetSystemTick();
+        for (RunningCase& running : running_cases) {
+            if (!running.timed_out && now > running.deadline) {
+                running.timed_out = true;
+                aborted_groups.insert(running.group);
+            }
+
+            // The result is logged as a TIMEOUT once the case returns. This note is for cases
+            // that never do, so the log shows what was running.
+            if (running.timed_out && !running.noted) {
+                running.noted = true;
+                notes.push_back(Common::FormatString("NOTE: [%s] %s still running after %llu ms\n",
+                                                     running.group.c_str(), running.name.c_str(),
+                                                     Common::TicksToMicroseconds(now - running.start) / 1000));
+            }
+
+            if (now > running.hang_deadline && abort_line.empty()) {
+                abort_line = Common::FormatString("ABORT: [%s] %s hung, ending the run\n",
+                                                  running.group.c_str(), running.name.c_str());
+            }
+        }
+    }
+
+    // A note that cannot get at the log is dropped; the ABORT line names the case if it hangs
+    for (const std::string& note : notes)
+        TryLogToFile(note, LOG_TIMEOUT_NS);
+
+    if (!abort_line.empty()) {
+        AbortOutput(abort_line, LOG_TIMEOUT_NS);
+        svcExitProcess();
+    }
+}
+
+static void MonitorThread(void*)
+{
+    while (svcWaitSynchronization(stop_event, POLL_INTERVAL_NS) != 0)
+        CheckCases();
+}
+
+void Start()
+{
+    if (monitor)
+        return;
+
+    svcCreateEvent(&stop_event, 0);
+    // Above the test threads, so spinning cases cannot starve it
+    monitor = new Common::Thread(MonitorThread, nullptr, Common::GetCurrentThreadPriority() - 1,
+                                 Common::CORE_APP);
+}
+
+void Stop()
+{
+    if (!monitor)
+        return;
+
+    svcSignalEvent(stop_event);
+    delete monitor;
+    monitor = nullptr;
+    svcCloseHandle(stop_event);
+}
+
+void BeginCase(const std::string& group, const std::string& name, u32 budget_ms)
+{
+    u64 start = svcGetSystemTick();
+    RunningCase running = { GetCurrentThreadId(), group, name, start,
+                            start + MillisecondsToTicks(budget_ms),
+                            start + MillisecondsToTicks(budget_ms + HANG_GRACE_MS), false, false };
+
+    Common::LockGuard lock(watchdog_mutex);
+    for (RunningCase& other : running_cases) {
+        if (other.thread_id == running.thread_id) {
+            other = running;
+            return;
+        }
+    }
+    running_cases.push_back(running);
+}
+
+bool EndCase()
+{
+    u32 thread_id = GetCurrentThreadId();
+
+    Common::LockGuard lock(watchdog_mutex);
+    for (size_t i = 0; i < running_cases.size(); i++) {
+        if (running_cases[i].thread_id == thread_id) {
+            bool timed_out = running_cases[i].timed_out;
+            running_cases.erase(running_cases.begin() + i);
+            return timed_out;
+        }
+    }
+    return false;
+}
+
+bool IsGroupAborted(const std::string& group)
+{
+    Common::LockGuard lock(watchdog_mutex);
+    return aborted_groups.count(group) != 0;
+}
+
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <string>
+
+#include <3ds.h>
+
+namespace Watchdog {
+
+/// Budget given to test cases that do not ask for a different one
+static const u32 DEFAULT_BUDGET_MS = 15000;
+
+/**
+ * Starts the monitor thread. When a test case runs past its budget, the monitor notes it in the
+ * log and marks its group as aborted; the case is logged as a TIMEOUT once it returns. A case that is still running long after its
+ * budget is considered hung, and the monitor ends the process so unattended runs always finish.
+ */
+void Start();
+void Stop();
+
+/// Starts timing the test case `name` of `group` on the calling thread.
+void BeginCase(const std::string& group, const std::string& name, u32 budget_ms);
+
+/// Stops timing the calling thread's case. Returns whether the case ran past its budget.
+bool EndCase();
+
+/// Returns whether a case of `group` timed out, so its remaining cases should be skipped.
+bool IsGroupAborted(const std::string& group);
+
+}
@@ -0,0 +1,120 @@
+#!/usr/bin/env python
+
+### Converts a font from the C source layout of tools/fonts/font1.cpp (a 256-entry Glyph
+### descriptor array followed by the 8-bit coverage array) into the packed format read by
+### source/font.cpp, which is embedded as data/font.bin.
+###
+### Usage: mkfont.py <font.cpp> <height> <output.bin>
+###
+### Packed layout (little endian):
+###   header      16 bytes: "HWFN", version, height, glyph count, glyph table offset,
+###               coverage offset
+###   codepoints  256 bytes: glyph index + 1 for each codepoint, 0 if there is no glyph
+###   glyphs      8 bytes each: coverage offset (u16), w, h, xo (s8), yo (s8), xa, flags
+###   coverage    column-major coverage of every glyph, either 8 bits per pixel or, for glyphs
+###               with GLYPH_RLE set in their flags, run-length encoded:
+###
+### Each column of an RLE glyph is a sequence of runs that never crosses into the next column.
+### A run starts with a byte holding the run type in its top two bits and the run length minus
+### one in the rest. Literal runs are followed by one coverage byte per pixel.
+
+import re
+import struct
+import sys
+
+MAGIC = b"HWFN"
+VERSION = 1
+HEADER_SIZE = 16
+CODEPOINTS = 256
+
+GLYPH_RLE = 0x01
+
+RUN_TRANSPARENT = 0
+RUN_OPAQUE = 1
+RUN_LITERAL = 2
+MAX_RUN = 64
+
+GLYPH_RE = re.compile(r"\{\s*(?:0|'(?:\\.|.)')\s*,\s*(-?\d+)\s*,\s*(-?\d+)\s*,\s*(-?\d+)\s*,\s*(-?\d+)\s*,"
+                      r"\s*(-?\d+)\s*,\s*(-?\d+)\s*,\s*(-?\d+)\s*,\s*(nullptr|&\w+\[(\d+)\])\s*\}")
+
+def parse_font_source(text):
+    desc_start = text.index("[] = {")
+    data_start = text.index("[] = {", desc_start + 1)
+
+    glyphs = []
+    for match in GLYPH_RE.finditer(text, desc_start, data_start):
+        x, y, w, h, xo, yo, xa = (int(v) for v in match.groups()[:7])
+        offset = None if match.group(8) == "nullptr" else int(match.group(9))
+        glyphs.append((w, h, xo, yo, xa, offset))
+    if len(glyphs) != CODEPOINTS:
+        raise ValueError("expected %d glyph descriptors, found %d" % (CODEPOINTS, len(glyphs)))
+
+    data = bytearray(int(v, 16) for v in re.findall(r"0x[0-9a-fA-F]+", text[data_start:]))
+    return glyphs, data
+
+def encode_column(column):
+    runs = bytearray()
+    pos = 0
+    while pos < len(column):
+        value = column[pos]
+        end = pos + 1
+        if value in (0x00, 0xFF):
+            while end < len(column) and end - pos < MAX_RUN and column[end] == value:
+                end += 1
+            kind = RUN_TRANSPARENT if value == 0x00 else RUN_OPAQUE
+            runs.append((kind << 6) | (end - pos - 1))
+        else:
+            while end < len(column) and end - pos < MAX_RUN and column[end] not in (0x00, 0xFF):
+                end += 1
+            runs.append((RUN_LITERAL << 6) | (end - pos - 1))
+            runs += column[pos:end]
+        pos = end
+    return runs
+
+def encode_glyph(pixels, w, h):
+    """Returns the coverage data and flags for a glyph, RLE encoded if that is smaller."""
+    runs = bytearray()
+    for x in range(w):
+        runs += encode_column(pixels[x * h:(x + 1) * h])
+    if len(runs) < len(pixels):
+        return runs, GLYPH_RLE
+    return pixels, 0
+
+def pack_font(glyphs, data, height):
+    codepoints = bytearray(CODEPOINTS)
+    records = b""
+    coverage = bytearray()
+
+    for codepoint, (w, h, xo, yo, xa, offset) in enumerate(glyphs):
+        if offset is None:
+            continue
+        if len(coverage) > 0xFFFF:
+            raise ValueError("coverage data does not fit a 16-bit offset")
+
+        index = len(records) // 8
+        codepoints[codepoint] = index + 1
+        pixels, flags = encode_glyph(data[offset:offset + w * h], w, h)
+        records += struct.pack("<HBBbbBB", len(coverage), w, h, xo, yo, xa, flags)
+        coverage += pixels
+
+    glyph_offset = HEADER_SIZE + CODEPOINTS
+    coverage_offset = glyph_offset + len(records)
+    header = struct.pack("<4sBBHII", MAGIC, VERSION, height, len(records) // 8,
+                         glyph_offset, coverage_offset)
+    return header + codepoints + records + coverage
+
+def main():
+    if len(sys.argv) != 4:
+        sys.exit("usage: %s <font.cpp> <height> <output.bin>" % sys.argv[0])
+
+    # The font sources contain raw Latin-1 characters
+    with open(sys.argv[1], "rb") as f:
+        text = f.read().decode("latin-1")
+
+    glyphs, data = parse_font_source(text)
+    blob = pack_font(glyphs, data, int(sys.argv[2]))
+    with open(sys.argv[3], "wb") as f:
+        f.write(blob)
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,100 @@
+// Generates hwtest_vectors.bin, the test vectors run by the CPU "Vectors" group, with the same
+// reference models and operand generator the on-device sweeps use. Copy the output to the root
+// of the SD card.
+//
+// Usage: g++ -std=c++11 -O2 -Isource -o mkvectors tools/mkvectors.cpp
+//        ./mkvectors hwtest_vectors.bin [random_per_instruction] [seed]
+//
+// Every instruction gets each pair of edge operands with a few fixed flag inputs, followed by
+// random operands and flags. Files only depend on the arguments, so they can be regenerated.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "tests/cpu/cpsr.h"
+#include "tests/cpu/cpu_ops.h"
+#include "tests/cpu/operands.h"
+#include "tests/cpu/vector_file.h"
+
+using namespace CPU;
+
+typedef uint32_t (*Reference)(uint32_t, uint32_t, uint32_t*);
+
+#define CPU_OP_REFERENCE(name, mnemonic, reference) reference,
+static const Reference REFERENCES[] = { CPU_FLAG_OPS(CPU_OP_REFERENCE) };
+#undef CPU_OP_REFERENCE
+
+// Same as Flags::FLAG_INPUTS in source/tests/cpu/flags.cpp
+static const uint32_t FLAG_INPUTS[] = {
+    0,
+    CPSR_FLAGS_MASK,
+    CPSR_N | CPSR_C | CPSR_Q | (0x5 << CPSR_GE_SHIFT),
+    CPSR_Z | CPSR_V | (0xA << CPSR_GE_SHIFT),
+};
+
+static VectorRecord MakeRecord(uint8_t opcode, uint32_t rn, uint32_t rm, uint32_t cpsr_in)
+{
+    uint32_t cpsr = cpsr_in;
+    VectorRecord record = {};
+    record.opcode = opcode;
+    record.flags_in = (uint16_t)(cpsr_in >> 16);
+    record.rn = rn;
+    record.rm = rm;
+    record.rd = REFERENCES[opcode](rn, rm, &cpsr);
+    record.flags_out = (uint16_t)(cpsr >> 16);
+    return record;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s <output> [random_per_instruction] [seed]\n", argv[0]);
+        return 1;
+    }
+    uint32_t random_count = (argc > 2) ? strtoul(argv[2], nullptr, 0) : 1 << 16;
+    uint32_t seed = (argc > 3) ? strtoul(argv[3], nullptr, 0) : 0x7E57C0DE;
+
+    std::vector<VectorRecord> records;
+    for (uint32_t op = 0; op < NUM_FLAG_OPS; op++) {
+        for (uint32_t flags : FLAG_INPUTS) {
+            for (uint32_t rn : EDGE_OPERANDS) {
+                for (uint32_t rm : EDGE_OPERANDS)
+                    records.push_back(MakeRecord(op, rn, rm, flags));
+            }
+        }
+
+        // Seeded per instruction, so appending instructions leaves the existing vectors alone
+        Common::XorShift32 rng(seed ^ (op * 0x9E3779B9));
+        for (uint32_t i = 0; i < random_count; i++) {
+            uint32_t rn = NextOperand(rng);
+            uint32_t rm = NextOperand(rng);
+            records.push_back(MakeRecord(op, rn, rm, rng.Next() & CPSR_FLAGS_MASK));
+        }
+    }
+
+    VectorFileHeader header = {};
+    memcpy(header.magic, VECTOR_FILE_MAGIC, sizeof(header.magic));
+    header.version = VECTOR_FILE_VERSION;
+    header.record_size = sizeof(VectorRecord);
+    header.record_count = records.size();
+    header.seed = seed;
+
+    FILE* file = fopen(argv[1], "wb");
+    if (!file) {
+        perror(argv[1]);
+        return 1;
+    }
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+              fwrite(records.data(), sizeof(VectorRecord), records.size(), file) == records.size();
+    if (fclose(file) != 0 || !ok) {
+        perror(argv[1]);
+        return 1;
+    }
+
+    printf("Wrote %u vectors for %u instructions to %s\n", (unsigned)records.size(),
+           (unsigned)NUM_FLAG_OPS, argv[1]);
+    return 0;
+}
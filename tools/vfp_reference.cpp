@@ -0,0 +1,231 @@
+// Generates source/tests/cpu/vfp_vectors.h, the expected results of the VFP tests, with the
+// host's IEEE 754 arithmetic. Needs an x86 host, whose SSE unit can flush denormals like the
+// VFP11 in RunFast mode.
+//
+// Usage: g++ -O0 -frounding-math -o vfp_reference tools/vfp_reference.cpp
+//        ./vfp_reference > source/tests/cpu/vfp_vectors.h
+//
+// The VFP tests run with flush-to-zero and default-NaN enabled, so denormal operands and results
+// are flushed to zero here too, and every NaN result is replaced by the default NaN.
+
+#include <cfenv>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <xmmintrin.h>
+#include <pmmintrin.h>
+
+// Same names as VfpOp in source/tests/cpu/vfp.cpp
+static const char* const OP_NAMES[] = {
+    "OP_FADDS", "OP_FSUBS", "OP_FMULS", "OP_FDIVS", "OP_FSQRTS",
+    "OP_FADDD", "OP_FSUBD", "OP_FMULD", "OP_FDIVD", "OP_FSQRTD",
+    "OP_FTOSIS", "OP_FTOSIZS", "OP_FTOUIS", "OP_FSITOS", "OP_FCVTDS", "OP_FCVTSD",
+};
+
+enum Op {
+    OP_FADDS, OP_FSUBS, OP_FMULS, OP_FDIVS, OP_FSQRTS,
+    OP_FADDD, OP_FSUBD, OP_FMULD, OP_FDIVD, OP_FSQRTD,
+    OP_FTOSIS, OP_FTOSIZS, OP_FTOUIS, OP_FSITOS, OP_FCVTDS, OP_FCVTSD,
+};
+
+// FPSCR rounding mode encoding, and the matching host mode
+static const char* const ROUNDING_NAMES[] = { "RN", "RP", "RM", "RZ" };
+static const int HOST_ROUNDING[] = { FE_TONEAREST, FE_UPWARD, FE_DOWNWARD, FE_TOWARDZERO };
+
+static const uint32_t DEFAULT_NAN_S = 0x7FC00000;
+static const uint64_t DEFAULT_NAN_D = 0x7FF8000000000000ULL;
+
+static float AsFloat(uint32_t bits) { float f; memcpy(&f, &bits, 4); return f; }
+static double AsDouble(uint64_t bits) { double d; memcpy(&d, &bits, 8); return d; }
+static uint32_t FloatBits(float f) { uint32_t bits; memcpy(&bits, &f, 4); return f != f ? DEFAULT_NAN_S : bits; }
+static uint64_t DoubleBits(double d) { uint64_t bits; memcpy(&bits, &d, 8); return d != d ? DEFAULT_NAN_D : bits; }
+
+struct Pair {
+    uint64_t a, b;
+};
+
+// Single precision operands. The first ones round differently in each mode or overflow.
+static const Pair SINGLE_PAIRS[] = {
+    { 0x3F800000, 0x40400000 }, // 1, 3
+    { 0xBF800000, 0x40400000 }, // -1, 3
+    { 0x40000000, 0x40400000 }, // 2, 3
+    { 0x3DCCCCCD, 0x3E4CCCCD }, // 0.1, 0.2
+    { 0x3F800000, 0x33800000 }, // 1, 2^-24: a tie when added
+    { 0x3F800000, 0x33C00000 }, // 1, 1.5 * 2^-24
+    { 0x7F7FFFFF, 0x7F7FFFFF }, // FLT_MAX, FLT_MAX
+    { 0x7149F2CA, 0x7149F2CA }, // 1e30, 1e30
+    { 0x80000000, 0x00000000 }, // -0, +0
+    { 0x00800000, 0x3F000000 }, // FLT_MIN, 0.5: denormal product
+    { 0x00000001, 0x3F800000 }, // smallest denormal, 1
+    { 0x7F800000, 0xFF800000 }, // inf, -inf
+    { 0x00000000, 0x00000000 }, // 0, 0
+    { 0x3F800000, 0x00000000 }, // 1, 0
+    { 0x7FC12345, 0x3F800000 }, // quiet NaN with payload, 1
+    { 0x7F800001, 0x3F800000 }, // signalling NaN, 1
+};
+static const int NUM_ROUNDING_PAIRS = 8;
+
+static const Pair DOUBLE_PAIRS[] = {
+    { 0x3FF0000000000000ULL, 0x4008000000000000ULL }, // 1, 3
+    { 0xBFF0000000000000ULL, 0x4008000000000000ULL }, // -1, 3
+    { 0x4000000000000000ULL, 0x4008000000000000ULL }, // 2, 3
+    { 0x3FB999999999999AULL, 0x3FC999999999999AULL }, // 0.1, 0.2
+    { 0x3FF0000000000000ULL, 0x3CA0000000000000ULL }, // 1, 2^-53: a tie when added
+    { 0x3FF0000000000000ULL, 0x3CA8000000000000ULL }, // 1, 1.5 * 2^-53
+    { 0x7FEFFFFFFFFFFFFFULL, 0x7FEFFFFFFFFFFFFFULL }, // DBL_MAX, DBL_MAX
+    { 0x7E37E43C8800759CULL, 0x7E37E43C8800759CULL }, // 1e300, 1e300
+    { 0x8000000000000000ULL, 0x0000000000000000ULL }, // -0, +0
+    { 0x0010000000000000ULL, 0x3FE0000000000000ULL }, // DBL_MIN, 0.5: denormal product
+    { 0x0000000000000001ULL, 0x3FF0000000000000ULL }, // smallest denormal, 1
+    { 0x7FF0000000000000ULL, 0xFFF0000000000000ULL }, // inf, -inf
+    { 0x0000000000000000ULL, 0x0000000000000000ULL }, // 0, 0
+    { 0x3FF0000000000000ULL, 0x0000000000000000ULL }, // 1, 0
+    { 0x7FF8000012345678ULL, 0x3FF0000000000000ULL }, // quiet NaN with payload, 1
+    { 0x7FF0000000000001ULL, 0x3FF0000000000000ULL }, // signalling NaN, 1
+};
+
+// Conversion operands
+static const uint32_t TO_INT_VALUES[] = {
+    0x40200000, 0xC0200000, 0x40600000, 0xBF000000, 0x3F000000, // 2.5, -2.5, 3.5, -0.5, 0.5
+    0x501502F9, 0xD01502F9, 0x4EFFFFFF, 0x4F000000, 0x4F800000, // 1e10, -1e10, 2^31 - 128, 2^31, 2^32
+    0x7FC00000, 0x7F800000, 0xFF800000, 0x80000000, 0x00000001, // NaN, inf, -inf, -0, denormal
+};
+static const uint32_t FROM_INT_VALUES[] = {
+    0x7FFFFFFF, 0x80000000, 0x01000001, 0xFEFFFFFF, 0x00000001, 0xFFFFFFFF,
+};
+static const uint64_t NARROW_VALUES[] = {
+    0x3FD5555555555555ULL, 0xBFD5555555555555ULL, // 1/3, -1/3
+    0x7E37E43C8800759CULL, 0xFE37E43C8800759CULL, // 1e300, -1e300
+    0x37A16C262777579CULL, 0x0000000000000001ULL, // 1e-40, denormal
+    0x7FF0000000000001ULL, 0x4005BF0A8B145769ULL, // signalling NaN, e
+};
+
+// Square roots only take the first operand, so pairs sharing it would give duplicate vectors
+static bool IsRepeatedOperand(const Pair* pairs, int index)
+{
+    for (int i = 0; i < index; i++)
+        if (pairs[i].a == pairs[index].a)
+            return true;
+    return false;
+}
+
+static void SetMode(int rounding)
+{
+    fesetround(HOST_ROUNDING[rounding]);
+    _MM_SET_FLUSH_ZERO_MODE(_MM_FLUSH_ZERO_ON);
+    _MM_SET_DENORMALS_ZERO_MODE(_MM_DENORMALS_ZERO_ON);
+}
+
+static uint64_t ComputeSingle(Op op, uint32_t a_bits, uint32_t b_bits)
+{
+    volatile float a = AsFloat(a_bits), b = AsFloat(b_bits);
+    switch (op) {
+    case OP_FADDS: return FloatBits(a + b);
+    case OP_FSUBS: return FloatBits(a - b);
+    case OP_FMULS: return FloatBits(a * b);
+    case OP_FDIVS: return FloatBits(a / b);
+    case OP_FSQRTS: return FloatBits(sqrtf(a));
+    default: return 0;
+    }
+}
+
+static uint64_t ComputeDouble(Op op, uint64_t a_bits, uint64_t b_bits)
+{
+    volatile double a = AsDouble(a_bits), b = AsDouble(b_bits);
+    switch (op) {
+    case OP_FADDD: return DoubleBits(a + b);
+    case OP_FSUBD: return DoubleBits(a - b);
+    case OP_FMULD: return DoubleBits(a * b);
+    case OP_FDIVD: return DoubleBits(a / b);
+    case OP_FSQRTD: return DoubleBits(sqrt(a));
+    default: return 0;
+    }
+}
+
+// Float to integer as FTOSI/FTOUI do it: NaN gives 0, out of range values saturate
+static uint64_t ToInt(uint32_t bits, bool is_signed, bool toward_zero)
+{
+    volatile float value = AsFloat(bits);
+    if (value != value)
+        return 0;
+    double rounded = toward_zero ? trunc((double)value) : nearbyint((double)value);
+    if (is_signed) {
+        if (rounded >= 2147483648.0) return 0x7FFFFFFF;
+        if (rounded < -2147483648.0) return 0x80000000;
+        return (uint32_t)(int32_t)rounded;
+    }
+    if (rounded >= 4294967296.0) return 0xFFFFFFFF;
+    if (rounded < 0.0) return 0;
+    return (uint32_t)rounded;
+}
+
+static void Emit(Op op, int rounding, uint64_t a, uint64_t b, uint64_t expected)
+{
+    printf("    { %-10s %s, 0x%016llXULL, 0x%016llXULL, 0x%016llXULL },\n",
+           (std::string(OP_NAMES[op]) + ",").c_str(), ROUNDING_NAMES[rounding],
+           (unsigned long long)a, (unsigned long long)b, (unsigned long long)expected);
+}
+
+int main()
+{
+    printf("// Generated by tools/vfp_reference.cpp. Do not edit.\n\n");
+    printf("#pragma once\n\n");
+    printf("static const VfpVector VFP_VECTORS[] = {\n");
+
+    const int num_pairs = sizeof(SINGLE_PAIRS) / sizeof(SINGLE_PAIRS[0]);
+    for (int op = OP_FADDS; op <= OP_FSQRTS; op++) {
+        for (int rounding = 0; rounding < 4; rounding++) {
+            for (int i = 0; i < (rounding == 0 ? num_pairs : NUM_ROUNDING_PAIRS); i++) {
+                const Pair& pair = SINGLE_PAIRS[i];
+                if (op == OP_FSQRTS && IsRepeatedOperand(SINGLE_PAIRS, i))
+                    continue;
+                SetMode(rounding);
+                uint64_t b = (op == OP_FSQRTS) ? 0 : pair.b;
+                Emit((Op)op, rounding, pair.a, b, ComputeSingle((Op)op, pair.a, b));
+            }
+        }
+    }
+
+    for (int op = OP_FADDD; op <= OP_FSQRTD; op++) {
+        for (int rounding = 0; rounding < 4; rounding++) {
+            for (int i = 0; i < (rounding == 0 ? num_pairs : NUM_ROUNDING_PAIRS); i++) {
+                const Pair& pair = DOUBLE_PAIRS[i];
+                if (op == OP_FSQRTD && IsRepeatedOperand(DOUBLE_PAIRS, i))
+                    continue;
+                SetMode(rounding);
+                uint64_t b = (op == OP_FSQRTD) ? 0 : pair.b;
+                Emit((Op)op, rounding, pair.a, b, ComputeDouble((Op)op, pair.a, b));
+            }
+        }
+    }
+
+    for (int rounding = 0; rounding < 4; rounding++) {
+        for (uint32_t value : TO_INT_VALUES) {
+            SetMode(rounding);
+            Emit(OP_FTOSIS, rounding, value, 0, ToInt(value, true, false));
+            Emit(OP_FTOSIZS, rounding, value, 0, ToInt(value, true, true));
+            Emit(OP_FTOUIS, rounding, value, 0, ToInt(value, false, false));
+        }
+        for (uint32_t value : FROM_INT_VALUES) {
+            SetMode(rounding);
+            volatile int32_t integer = (int32_t)value;
+            Emit(OP_FSITOS, rounding, value, 0, FloatBits((float)integer));
+        }
+        for (uint64_t value : NARROW_VALUES) {
+            SetMode(rounding);
+            volatile double wide = AsDouble(value);
+            Emit(OP_FCVTSD, rounding, value, 0, FloatBits((float)wide));
+        }
+    }
+
+    for (uint32_t value : TO_INT_VALUES) {
+        SetMode(0);
+        volatile float narrow = AsFloat(value);
+        Emit(OP_FCVTDS, 0, value, 0, DoubleBits((double)narrow));
+    }
+
+    printf("};\n");
+    return 0;
+}